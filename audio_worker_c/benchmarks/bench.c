@@ -0,0 +1,210 @@
+// Native kernel benchmark harness for the audio worker.
+//
+// The Python benchmark in this directory measures end-to-end latency
+// through Redis, which hides kernel-level regressions. This binary times
+// the effect, conversion and codec kernels directly on synthetic buffers
+// of several sizes and reports samples/sec and ns/sample per kernel, so
+// optimization work can be gated per commit. Run via `make bench`.
+
+#include "audio_processing.h"
+#include "base64.h"
+#include "wav_writer.h"
+#include "buffer_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+// Minimum wall time per measurement; iterations repeat until this elapses
+#define BENCH_MIN_SECONDS 0.2
+
+static const size_t bench_sizes[] = {4410, 44100, 441000}; // 0.1s, 1s, 10s @ 44.1kHz
+#define NUM_SIZES (sizeof(bench_sizes) / sizeof(bench_sizes[0]))
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Deterministic test signal: a mix of tones with some noise, loud enough
+// to exercise clipping paths but not fully saturated
+static void fill_signal(sample_t *data, size_t length) {
+    uint32_t noise = 0x2545F491u;
+    for (size_t i = 0; i < length; i++) {
+        float t = (float)i / 44100.0f;
+        float value = 0.4f * sinf(2.0f * (float)M_PI * 440.0f * t) +
+                      0.2f * sinf(2.0f * (float)M_PI * 1760.0f * t);
+        noise = noise * 1664525u + 1013904223u;
+        value += 0.05f * (((float)(noise >> 8) / (float)(1u << 24)) * 2.0f - 1.0f);
+        data[i] = clamp_sample(value * 32767.0f);
+    }
+}
+
+static void report(const char *name, size_t size, size_t iterations, double elapsed) {
+    double total_samples = (double)size * (double)iterations;
+    printf("  %-26s %8zu samples  %9.2f M samples/s  %8.2f ns/sample\n",
+           name, size, total_samples / elapsed / 1e6, elapsed * 1e9 / total_samples);
+}
+
+// Effect benchmarks run on a scratch copy so every iteration sees the
+// same input (some kernels are destructive in interesting ways)
+typedef int (*effect_fn)(audio_buffer_t *buffer);
+
+static void bench_effect(const char *name, effect_fn fn,
+                         const audio_buffer_t *input, audio_buffer_t *scratch) {
+    size_t iterations = 0;
+    double elapsed;
+    double start = now_seconds();
+
+    do {
+        memcpy(scratch->data, input->data, input->length * sizeof(sample_t));
+        scratch->length = input->length;
+        fn(scratch);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+
+    report(name, input->length, iterations, elapsed);
+}
+
+// Default parameters, mirroring parse_effects_from_json
+static filter_params_t lp_params = {2000.0f, 4};
+static filter_params_t hp_params = {300.0f, 4};
+static reverb_params_t reverb_params = {0.7f, 0.5f, 0.3f, 2.0f, 0};
+static reverb_params_t reverb_fft_params = {0.7f, 0.5f, 0.3f, 2.0f, 1};
+static echo_params_t echo_params = {300.0f, 0.5f, 3};
+static pitch_params_t pitch_params = {3.0f};
+static distortion_params_t distortion_params = {2.5f, 0.7f};
+
+static int run_low_pass(audio_buffer_t *b) { return apply_low_pass_filter(b, &lp_params); }
+static int run_high_pass(audio_buffer_t *b) { return apply_high_pass_filter(b, &hp_params); }
+static int run_reverb(audio_buffer_t *b) { return apply_reverb(b, &reverb_params); }
+static int run_reverb_fft(audio_buffer_t *b) { return apply_reverb(b, &reverb_fft_params); }
+static int run_echo(audio_buffer_t *b) { return apply_echo(b, &echo_params); }
+static int run_pitch_shift(audio_buffer_t *b) { return apply_pitch_shift(b, &pitch_params); }
+static int run_distortion(audio_buffer_t *b) { return apply_distortion(b, &distortion_params); }
+static int run_normalize(audio_buffer_t *b) { return normalize_audio(b); }
+
+static void bench_conversions(const audio_buffer_t *input) {
+    float_sample_t *floats = malloc(input->length * sizeof(float_sample_t));
+    sample_t *ints = malloc(input->length * sizeof(sample_t));
+    if (!floats || !ints) {
+        free(floats);
+        free(ints);
+        return;
+    }
+
+    size_t iterations = 0;
+    double elapsed;
+    double start = now_seconds();
+    do {
+        samples_to_float(input->data, floats, input->length);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    report("samples_to_float", input->length, iterations, elapsed);
+
+    iterations = 0;
+    start = now_seconds();
+    do {
+        samples_from_float(floats, ints, input->length);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    report("samples_from_float", input->length, iterations, elapsed);
+
+    free(floats);
+    free(ints);
+}
+
+static void bench_base64(const audio_buffer_t *input) {
+    size_t raw_len = input->length * sizeof(sample_t);
+    char *encoded = malloc(base64_encoded_size(raw_len) + 1);
+    unsigned char *decoded = malloc(raw_len + 4);
+    if (!encoded || !decoded) {
+        free(encoded);
+        free(decoded);
+        return;
+    }
+
+    size_t iterations = 0;
+    double elapsed;
+    double start = now_seconds();
+    do {
+        base64_encode((const unsigned char *)input->data, raw_len, encoded);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    report("base64_encode", input->length, iterations, elapsed);
+
+    size_t decoded_len = 0;
+    iterations = 0;
+    start = now_seconds();
+    do {
+        base64_decode(encoded, decoded, &decoded_len);
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    report("base64_decode", input->length, iterations, elapsed);
+
+    free(encoded);
+    free(decoded);
+}
+
+static void bench_wav(const audio_buffer_t *input) {
+    size_t iterations = 0;
+    double elapsed;
+    double start = now_seconds();
+    do {
+        uint8_t *wav_data = NULL;
+        size_t wav_size = 0;
+        if (create_wav_file(input->data, input->length, input->sample_rate,
+                            input->channels, &wav_data, &wav_size) == 0) {
+            pool_free(wav_data);
+        }
+        iterations++;
+        elapsed = now_seconds() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+    report("create_wav_file", input->length, iterations, elapsed);
+}
+
+int main(void) {
+    printf("📈 Audio worker kernel benchmarks\n");
+    printf("   (each kernel runs for at least %.1fs per size)\n", BENCH_MIN_SECONDS);
+
+    for (size_t s = 0; s < NUM_SIZES; s++) {
+        size_t size = bench_sizes[s];
+
+        audio_buffer_t *input = audio_buffer_create(size, 44100, 1);
+        audio_buffer_t *scratch = audio_buffer_create(size, 44100, 1);
+        if (!input || !scratch) {
+            fprintf(stderr, "Failed to allocate %zu-sample benchmark buffers\n", size);
+            return 1;
+        }
+        fill_signal(input->data, size);
+        input->length = size;
+
+        printf("\n-- %zu samples (%.1fs @ 44.1kHz) --\n", size, (double)size / 44100.0);
+
+        bench_effect("apply_low_pass_filter", run_low_pass, input, scratch);
+        bench_effect("apply_high_pass_filter", run_high_pass, input, scratch);
+        bench_effect("apply_reverb (comb)", run_reverb, input, scratch);
+        bench_effect("apply_reverb (fft)", run_reverb_fft, input, scratch);
+        bench_effect("apply_echo", run_echo, input, scratch);
+        bench_effect("apply_pitch_shift", run_pitch_shift, input, scratch);
+        bench_effect("apply_distortion", run_distortion, input, scratch);
+        bench_effect("normalize_audio", run_normalize, input, scratch);
+
+        bench_conversions(input);
+        bench_base64(input);
+        bench_wav(input);
+
+        audio_buffer_destroy(input);
+        audio_buffer_destroy(scratch);
+    }
+
+    printf("\n✅ Benchmarks completed\n");
+    return 0;
+}
@@ -9,9 +9,12 @@ void audio_buffer_destroy(audio_buffer_t *buffer);
 int audio_buffer_resize(audio_buffer_t *buffer, size_t new_capacity);
 int audio_buffer_copy(const audio_buffer_t *src, audio_buffer_t *dst);
 
-// Audio format conversion
+// Audio format conversion. The _scaled variant folds a gain multiply into
+// the int16 conversion, so normalization costs no separate scaling pass.
 int samples_to_float(const sample_t *input, float_sample_t *output, size_t length);
 int samples_from_float(const float_sample_t *input, sample_t *output, size_t length);
+int samples_from_float_scaled(const float_sample_t *input, sample_t *output,
+                              size_t length, float gain);
 
 // Audio effects (all process in-place to minimize memory usage)
 int apply_low_pass_filter(audio_buffer_t *buffer, const filter_params_t *params);
@@ -22,6 +25,65 @@ int apply_pitch_shift(audio_buffer_t *buffer, const pitch_params_t *params);
 int apply_distortion(audio_buffer_t *buffer, const distortion_params_t *params);
 int normalize_audio(audio_buffer_t *buffer);
 
+// Float-domain effect kernels. The fused pipeline in process_audio_job
+// converts int16 -> float once, chains these back-to-back on the float
+// buffer, and converts back once at the end, instead of paying a full
+// int16<->float round trip (and its requantization loss) per effect.
+//
+// Multichannel buffers are interleaved frames and length counts samples
+// (frames * channels). The stateful kernels keep filter history and delay
+// lines per channel; the channel-inner loops over adjacent interleaved
+// samples form natural 2-/4-wide SIMD lanes for the compiler.
+int effect_low_pass_f(float_sample_t *samples, size_t length,
+                      uint32_t sample_rate, uint16_t channels,
+                      const filter_params_t *params);
+int effect_high_pass_f(float_sample_t *samples, size_t length,
+                       uint32_t sample_rate, uint16_t channels,
+                       const filter_params_t *params);
+int effect_reverb_f(float_sample_t *samples, size_t length,
+                    uint32_t sample_rate, uint16_t channels,
+                    const reverb_params_t *params);
+int effect_echo_f(float_sample_t *samples, size_t length,
+                  uint32_t sample_rate, uint16_t channels,
+                  const echo_params_t *params);
+int effect_pitch_shift_f(float_sample_t *samples, size_t length,
+                         uint16_t channels, const pitch_params_t *params);
+int effect_distortion_f(float_sample_t *samples, size_t length,
+                        const distortion_params_t *params);
+int normalize_audio_f(float_sample_t *samples, size_t length);
+float audio_peak_f(const float_sample_t *samples, size_t length);
+
+// Chunked (streaming) effect processing. Every effect except pitch shift
+// is causal with small state (biquad history, reverb/echo delay lines), so
+// long clips can be processed in bounded blocks with the state carried
+// across block boundaries, keeping peak memory O(block) instead of O(clip).
+typedef struct audio_stream_state audio_stream_state_t;
+
+int audio_stream_supported(uint32_t effects_mask);
+audio_stream_state_t* audio_stream_state_create(const audio_job_t *job,
+                                                uint32_t sample_rate,
+                                                uint16_t channels);
+void audio_stream_state_destroy(audio_stream_state_t *state);
+// Block boundaries must fall on frame boundaries: length is a multiple of
+// the channel count the state was created with
+int audio_stream_process_block(audio_stream_state_t *state,
+                               float_sample_t *samples, size_t length);
+float audio_stream_peak(const audio_stream_state_t *state);
+
+// Specialized fused kernels for the effect masks that dominate traffic:
+// one loop applies input conversion, the whole chain and the peak scan
+// per sample, so hot-chain clips cross memory once instead of once per
+// stage. Returns 1 if the chain matched a specialized kernel and output
+// was rendered (peak_out receives the pre-normalization peak), 0 if the
+// caller should run the generic multi-pass pipeline instead.
+// audio_fused_supported answers the same question without running, for
+// callers that choose their ingest strategy up front.
+int audio_fused_supported(const audio_job_t *job);
+int audio_fused_process(const audio_job_t *job, const sample_t *input,
+                        sample_t *output, size_t length,
+                        uint32_t sample_rate, uint16_t channels,
+                        float *peak_out);
+
 // Job processing
 int process_audio_job(audio_job_t *job);
 
@@ -3,11 +3,17 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "job_timing.h"
 
 // Audio sample types
 typedef int16_t sample_t;
 typedef float float_sample_t;
 
+// Multichannel audio is carried as interleaved frames (one sample per
+// channel per frame); this caps the per-channel state kept by the
+// stateful effects
+#define AUDIO_MAX_CHANNELS 8
+
 // Audio buffer structure
 typedef struct {
     sample_t *data;
@@ -27,6 +33,8 @@ typedef struct {
     float room_size;
     float damping;
     float wet_level;
+    float tail_seconds;   // Convolution engine: impulse response length
+    int use_convolution;  // 0 = comb filter, 1 = partitioned FFT convolution
 } reverb_params_t;
 
 typedef struct {
@@ -66,6 +74,7 @@ typedef struct {
     echo_params_t echo;
     pitch_params_t pitch;
     distortion_params_t distortion;
+    job_timing_t *timing;  // optional per-stage instrumentation (may be NULL)
 } audio_job_t;
 
 #endif // AUDIO_TYPES_H
\ No newline at end of file
@@ -4,9 +4,26 @@
 #include <stddef.h>
 
 // Base64 encoding/decoding functions
+//
+// Encode and decode use vectorized kernels (AVX2 on x86_64, NEON on
+// aarch64) selected at runtime, with the portable scalar code as the
+// fallback and for block tails.
 size_t base64_encoded_size(size_t input_len);
 size_t base64_decoded_size(const char *input);
 int base64_encode(const unsigned char *input, size_t input_len, char *output);
 int base64_decode(const char *input, unsigned char *output, size_t *output_len);
 
-#endif // BASE64_H
\ No newline at end of file
+// Length-taking variants for callers that already know the input length
+// (e.g. from a Redis reply); these skip the strlen pass over the payload.
+size_t base64_decoded_size_len(const char *input, size_t input_len);
+int base64_decode_len(const char *input, size_t input_len,
+                      unsigned char *output, size_t *output_len);
+
+// Fused ingest: decode base64 straight to int16-scaled float samples in
+// one L1-blocked pass, so the caller needs no clip-sized PCM staging
+// buffer and no separate int16-to-float sweep. A trailing odd byte (half
+// a sample) is dropped, matching the plain decode-then-truncate path.
+int base64_decode_to_float(const char *input, size_t input_len,
+                           float *output, size_t *sample_count_out);
+
+#endif // BASE64_H
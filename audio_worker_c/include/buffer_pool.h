@@ -0,0 +1,45 @@
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stddef.h>
+
+// Per-worker arena allocator for job-scoped buffers.
+//
+// Each worker thread owns one pool and binds it before processing jobs.
+// While a pool is bound, pool_malloc/pool_calloc carve from the arena and
+// pool_free on arena pointers is a no-op; the arena is rewound with
+// buffer_pool_reset between jobs. Blocks are kept high-water-mark style,
+// so steady-state processing does zero heap allocation once the pool has
+// grown to the largest job seen.
+//
+// When no pool is bound (or for pointers not owned by the bound pool),
+// the pool_* functions fall back to plain malloc/calloc/free, so shared
+// code paths work identically outside the worker loop.
+
+typedef struct buffer_pool buffer_pool_t;
+
+buffer_pool_t* buffer_pool_create(size_t initial_block_size);
+void buffer_pool_destroy(buffer_pool_t *pool);
+void buffer_pool_reset(buffer_pool_t *pool);
+
+// Occupancy introspection (bytes)
+size_t buffer_pool_capacity(const buffer_pool_t *pool);
+size_t buffer_pool_in_use(const buffer_pool_t *pool);
+
+// Aggregate occupancy across every live pool, for the metrics endpoint.
+// In-use numbers are read without locking the owning threads, so they are
+// a snapshot, not an exact figure.
+void buffer_pool_global_stats(size_t *total_capacity, size_t *total_in_use,
+                              int *pool_count);
+
+// Bind/unbind the calling thread's active pool
+void buffer_pool_bind(buffer_pool_t *pool);
+void buffer_pool_unbind(void);
+
+// Allocation shims used by the job path
+void* pool_malloc(size_t size);
+void* pool_calloc(size_t count, size_t size);
+void* pool_realloc(void *ptr, size_t old_size, size_t new_size);
+void pool_free(void *ptr);
+
+#endif // BUFFER_POOL_H
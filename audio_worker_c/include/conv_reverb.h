@@ -0,0 +1,39 @@
+#ifndef CONV_REVERB_H
+#define CONV_REVERB_H
+
+#include "audio_types.h"
+
+/**
+ * Partitioned FFT convolution reverb.
+ *
+ * The impulse response (an exponentially decaying noise tail shaped by
+ * room_size/damping, up to tail_seconds long) is split into uniform
+ * partitions. Each input block is FFT'd once and multiplied against all
+ * partition spectra through a frequency-domain delay line, making the
+ * cost O(n log n) in tail length instead of the O(n * tail) a time-domain
+ * convolution of a multi-second tail would cost.
+ *
+ * The engine is stateful and streaming-friendly: blocks of any length
+ * can be fed in sequence and the delay line carries across calls. A
+ * length that is not a multiple of the partition size (4096 samples) is
+ * only valid as the final block of a clip.
+ */
+typedef struct conv_reverb conv_reverb_t;
+
+/**
+ * Create a convolution reverb engine for the given parameters
+ * @param params Reverb parameters (room_size, damping, wet_level, tail_seconds)
+ * @param sample_rate Sample rate in Hz
+ * @return Engine handle, or NULL on error (allocates from the worker pool)
+ */
+conv_reverb_t* conv_reverb_create(const reverb_params_t *params, uint32_t sample_rate);
+
+void conv_reverb_destroy(conv_reverb_t *reverb);
+
+/**
+ * Process a block of samples in place (dry/wet mixed per wet_level)
+ * @return 0 on success, -1 on error
+ */
+int conv_reverb_process(conv_reverb_t *reverb, float_sample_t *samples, size_t length);
+
+#endif // CONV_REVERB_H
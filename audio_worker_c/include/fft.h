@@ -0,0 +1,26 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <stddef.h>
+
+/**
+ * In-place iterative radix-2 complex FFT (Cooley-Tukey).
+ *
+ * Small and dependency-free on purpose: the worker only needs FFTs of a
+ * few fixed power-of-two sizes (convolution partitions), so a tuned
+ * external library would buy little over this.
+ *
+ * @param re Real parts, length n (modified in place)
+ * @param im Imaginary parts, length n (modified in place)
+ * @param n  Transform size, must be a power of two
+ * @return 0 on success, -1 on error
+ */
+int fft_forward(float *re, float *im, size_t n);
+
+/**
+ * Inverse transform of fft_forward. Output is scaled by 1/n, so
+ * fft_inverse(fft_forward(x)) == x.
+ */
+int fft_inverse(float *re, float *im, size_t n);
+
+#endif // FFT_H
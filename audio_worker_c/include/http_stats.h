@@ -0,0 +1,32 @@
+#ifndef HTTP_STATS_H
+#define HTTP_STATS_H
+
+/**
+ * Embedded HTTP stats endpoint.
+ *
+ * A single background thread serves:
+ *   GET /health   - liveness/readiness probe for the platform
+ *   GET /metrics  - Prometheus text format: job throughput, per-stage
+ *                   latency histograms, queue-wait estimates, buffer-pool
+ *                   occupancy and Redis error counts
+ *
+ * The worker loops feed the counters through the record functions below;
+ * everything else (stage histograms, pool occupancy, Redis errors) is
+ * pulled from the owning modules at scrape time.
+ */
+
+// Start the listener thread on the given port; 0 on success
+int http_stats_start(int port);
+
+// Stop the listener thread and close the socket (blocks until joined)
+void http_stats_stop(void);
+
+// Job completed (success or failure)
+void http_stats_record_job(int success);
+
+// A queue poll finished: wait_ms spent blocked in BRPOP, got_job says
+// whether it returned work. Low waits with jobs mean backlog; timeouts
+// mean an idle worker - together they estimate queue pressure.
+void http_stats_record_poll(double wait_ms, int got_job);
+
+#endif // HTTP_STATS_H
@@ -0,0 +1,58 @@
+#ifndef JOB_TIMING_H
+#define JOB_TIMING_H
+
+/**
+ * Per-stage job instrumentation.
+ *
+ * All timestamps come from CLOCK_MONOTONIC, so the recorded numbers are
+ * wall time: Redis waits show up instead of disappearing the way they
+ * did with clock(), which only counts CPU time. Each job fills in a
+ * job_timing_t as it moves through the pipeline; completed jobs are
+ * folded into worker-global per-stage histograms that print_stats()
+ * emits periodically.
+ */
+
+typedef enum {
+    STAGE_REDIS_FETCH = 0, // pipelined status/input/metadata fetch
+    STAGE_DECODE,          // base64 decode (+ int16 -> float conversion)
+    STAGE_LOW_PASS,
+    STAGE_HIGH_PASS,
+    STAGE_REVERB,
+    STAGE_ECHO,
+    STAGE_PITCH_SHIFT,
+    STAGE_DISTORTION,
+    STAGE_EFFECTS_FUSED,   // streaming path: whole effect chain per block
+    STAGE_NORMALIZE,
+    STAGE_WAV_BUILD,
+    STAGE_ENCODE,          // base64 encode of the result
+    STAGE_REDIS_STORE,     // pipelined result/metadata/status store
+    STAGE_COUNT
+} timing_stage_t;
+
+typedef struct {
+    double stage_ms[STAGE_COUNT];
+    double total_ms;
+} job_timing_t;
+
+// Current CLOCK_MONOTONIC time in milliseconds
+double timing_now_ms(void);
+
+void job_timing_reset(job_timing_t *timing);
+
+// Accumulate elapsed milliseconds into a stage; NULL timing is a no-op so
+// library callers without instrumentation pay nothing
+void job_timing_add(job_timing_t *timing, timing_stage_t stage, double elapsed_ms);
+
+const char* timing_stage_name(timing_stage_t stage);
+
+// Fold a completed job into the worker-global histograms (thread-safe)
+void timing_record_job(const job_timing_t *timing);
+
+// Print accumulated per-stage histograms (called from print_stats)
+void timing_print_stats(void);
+
+// Write the accumulated histograms in Prometheus text format (cumulative
+// le buckets per stage); returns bytes written, truncating at buf_size
+unsigned long timing_write_prometheus(char *buf, unsigned long buf_size);
+
+#endif // JOB_TIMING_H
@@ -0,0 +1,75 @@
+#ifndef JSON_LITE_H
+#define JSON_LITE_H
+
+#include <stddef.h>
+
+// Minimal in-place JSON scanner and append-style writer for the job
+// metadata hot path. json-c builds a heap DOM (dozens of allocations)
+// per parse, which is most of the metadata cost on short interactive
+// jobs; these helpers read values straight out of the source string and
+// serialize into a caller-supplied buffer, allocating nothing.
+//
+// The scanner understands exactly the shapes the worker uses: one flat
+// top-level object whose values it can skip over (strings, numbers,
+// literals, nested arrays/objects). Lookups return 1 when the key is
+// found with the expected type, 0 when it is absent (or, for ints, has
+// a non-integer value - the caller's fallback applies either way), and
+// -1 when the document is malformed or uses something the scanner does
+// not handle (e.g. string escapes in a wanted value); on -1 the caller
+// falls back to json-c, which stays the parser of record for unknown
+// schemas.
+
+// Locate a top-level string value; *value_out/*len_out reference the
+// bytes between the quotes in the source document (no copy, no
+// unescaping - values containing a backslash report -1)
+int json_lite_get_string(const char *json, const char *key,
+                         const char **value_out, size_t *len_out);
+
+// Locate a top-level integer value
+int json_lite_get_int(const char *json, const char *key, int *value_out);
+
+// Locate a top-level numeric value of any width as a double (doubles
+// hold e.g. epoch-millisecond timestamps exactly, which overflow int)
+int json_lite_get_number(const char *json, const char *key, double *value_out);
+
+// Invoke fn for each string element of a top-level array value, in
+// order; non-string elements and escaped strings report -1. A non-zero
+// return from fn stops the walk (and is returned).
+typedef int (*json_lite_string_fn)(const char *value, size_t length, void *arg);
+int json_lite_each_string(const char *json, const char *key,
+                          json_lite_string_fn fn, void *arg);
+
+// Whether the object has a given top-level key (1/0/-1 as above)
+int json_lite_has_key(const char *json, const char *key);
+
+// Validate that the document is one well-formed top-level object and
+// return the offset of its closing brace, so a writer can copy the
+// prefix and append members in place of the '}'. Returns 0 on success
+// (with *has_members_out telling the writer whether a leading comma is
+// needed), -1 for anything else.
+int json_lite_object_end(const char *json, size_t *end_out, int *has_members_out);
+
+// Append-style serializer over a caller-supplied (stack or arena)
+// buffer. Overflow or any earlier error latches the error flag and
+// turns the remaining calls into no-ops; check json_writer_ok before
+// using the result. Strings are escaped on the way in; need_comma is
+// exposed so a copied object prefix can seed the separator state.
+typedef struct {
+    char *buf;
+    size_t cap;
+    size_t len;
+    int need_comma;
+    int error;
+} json_writer_t;
+
+void json_writer_init(json_writer_t *w, char *buf, size_t cap);
+void json_writer_raw(json_writer_t *w, const char *data, size_t len);
+void json_writer_member_string(json_writer_t *w, const char *key, const char *value);
+void json_writer_member_double(json_writer_t *w, const char *key, double value);
+// Nested object member: open emits "key":{ and resets the separator
+// state; close emits the brace. One level is enough for the metadata.
+void json_writer_open_object(json_writer_t *w, const char *key);
+void json_writer_close_object(json_writer_t *w);
+int json_writer_ok(const json_writer_t *w);
+
+#endif // JSON_LITE_H
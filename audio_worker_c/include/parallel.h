@@ -0,0 +1,35 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+
+// Intra-job parallelism: fork/join over a sample (or unit) range for the
+// stages that are embarrassingly parallel - format conversions, the peak
+// scan, distortion, base64 encode/decode. One huge clip then scales with
+// the pod's CPU allocation instead of its single-core clock.
+//
+// parallel_for splits [0, length) into up to parallel_worker_count()
+// contiguous chunks of at least min_chunk units each and runs fn on every
+// chunk; small inputs run inline on the calling thread, so callers use
+// one code path regardless of size. chunk_index identifies the chunk for
+// per-chunk reduction slots. Returns the number of chunks executed
+// (0 when length is 0).
+//
+// Worker count follows the online CPU count (capped at 8) and can be
+// overridden with INTRA_JOB_THREADS; 1 disables intra-job parallelism.
+#define PARALLEL_MAX_THREADS 8
+
+// Default grains: memory-bound sweeps want big chunks so the fork/join
+// cost stays well under the memory time; compute-bound kernels (tanh)
+// amortize it much earlier.
+#define PARALLEL_GRAIN_MEMBOUND (1024 * 1024)
+#define PARALLEL_GRAIN_COMPUTE  (256 * 1024)
+
+typedef void (*parallel_range_fn)(size_t start, size_t end,
+                                  int chunk_index, void *arg);
+
+int parallel_worker_count(void);
+int parallel_for(size_t length, size_t min_chunk,
+                 parallel_range_fn fn, void *arg);
+
+#endif // PARALLEL_H
@@ -11,6 +11,15 @@ typedef struct {
     int port;
     char *password;
     int db;
+
+    // Streams backend state (QUEUE_BACKEND=stream)
+    char *consumer_name;     // unique consumer id within the group
+    char *pending_entry_id;  // stream entry of the last popped job, until taken
+    int stream_group_ready;
+    unsigned int pop_count;
+
+    // In-flight APPENDs of a chunked result upload awaiting their replies
+    int result_inflight;
 } redis_client_t;
 
 // Job data structure for Redis operations
@@ -29,8 +38,97 @@ void redis_client_destroy(redis_client_t *client);
 int redis_client_connect(redis_client_t *client);
 int redis_client_ping(redis_client_t *client);
 
-// Job queue operations
+// Job queue operations.
+//
+// Two backends, selected with QUEUE_BACKEND:
+//   list (default) - BRPOP audio:queue. Fast, but a job popped by a pod
+//                    that dies mid-processing is lost forever.
+//   stream         - XREADGROUP on the audio:stream stream (entries are
+//                    XADD'd by producers with a "job" field holding the
+//                    job id) through the audio-workers consumer group.
+//                    Unacked entries from dead consumers are reclaimed
+//                    with XAUTOCLAIM after 60s idle, giving at-least-once
+//                    delivery across pod restarts and preemptions.
+//
+// In stream mode redis_pop_job records the popped entry id on the client;
+// take it with redis_client_take_entry_id (ownership transfers, it may
+// cross to another client) and XACK it with redis_ack_job once the job
+// has a recorded outcome. Both are no-ops in list mode.
 char* redis_pop_job(redis_client_t *client, int timeout_seconds);
+int redis_queue_uses_streams(void);
+
+// Priority lanes for the list backend. Configure once at startup with an
+// ordered comma-separated key list (highest priority first); one BRPOP
+// then watches all lanes and Redis serves the leftmost non-empty key, so
+// short interactive jobs are never stuck behind hour-long batch work.
+// Unconfigured workers keep the single audio:queue behavior. The lane
+// accessors feed the per-queue counters in the stats output.
+int redis_queues_configure(const char *csv);
+int redis_queue_lane_count(void);
+const char* redis_queue_lane_name(int index);
+unsigned long long redis_queue_lane_pops(int index);
+char* redis_client_take_entry_id(redis_client_t *client);
+int redis_ack_job(redis_client_t *client, const char *entry_id);
+
+// Pipelined job lifecycle operations. These batch the per-job round trips
+// (status/input/metadata on the way in, result/metadata/status on the way
+// out) into a single network flush each, so a job costs two round trips
+// instead of six when Redis is remote.
+//
+// Payloads are binary-safe: input is returned with its exact length (the
+// buffer is NUL-terminated for text payloads), and results are stored with
+// %b so raw PCM/WAV bytes can be shipped without a base64 detour.
+//
+// redis_fetch_job returns a NULL input (with rc 0) when the input key is
+// absent: path-transport jobs keep the payload on a shared volume and
+// reference it from the metadata, so the caller decides whether a missing
+// inline payload is an error. redis_finish_job_meta completes such jobs
+// with metadata and status only.
+int redis_fetch_job(redis_client_t *client, const char *job_id,
+                    char **input_data, size_t *input_len, char **metadata_json);
+int redis_finish_job(redis_client_t *client, const char *job_id,
+                     const void *result_data, size_t result_len,
+                     const char *metadata_json);
+int redis_finish_job_meta(redis_client_t *client, const char *job_id,
+                          const char *metadata_json);
+int redis_fail_job(redis_client_t *client, const char *job_id,
+                   const char *error_message);
+
+// Chunked result upload for large payloads. redis_finish_job ships the
+// whole result as one SET, which means a second result-sized copy inside
+// hiredis's command buffer and one multi-megabyte command for the server
+// to swallow. The chunked writer APPENDs bounded pieces to the same
+// result key instead - readers still GET the one key they always did -
+// so worker-side memory for the wire copy is O(chunk) and the server
+// handles many small commands instead of one latency spike.
+//
+// Usage: begin (clears any stale value from a retried job), append each
+// chunk in order, then commit with the final metadata (mirrors
+// redis_finish_job's metadata + status handling). Appends are pipelined
+// a few commands deep; commit drains the window. After any -1 the key
+// is partial: call abort - which drains every outstanding reply so the
+// connection stays usable and deletes the TTL-less partial value - and
+// fail the job rather than committing.
+int redis_result_begin(redis_client_t *client, const char *job_id);
+int redis_result_append(redis_client_t *client, const char *job_id,
+                        const void *chunk, size_t chunk_len);
+int redis_result_commit(redis_client_t *client, const char *job_id,
+                        const char *metadata_json);
+int redis_result_abort(redis_client_t *client, const char *job_id);
+
+// Content-addressable result cache (audio:cache:<hash>, same 3600s TTL as
+// the job keys). Payloads are moved server-side with COPY so a hit or a
+// store never re-sends the result over the network; on Redis older than
+// 6.2 COPY fails and every lookup degrades to a miss.
+//
+// redis_cache_complete_job copies the cached result onto the job's result
+// key and marks the job completed. Returns 1 on a hit, 0 on a miss, -1 on
+// a broken connection. redis_cache_store duplicates a just-stored job
+// result under the cache key for future hits.
+int redis_cache_complete_job(redis_client_t *client, const char *job_id,
+                             const char *cache_key, const char *metadata_json);
+int redis_cache_store(redis_client_t *client, const char *cache_key,
+                      const char *job_id);
 int redis_update_job_status(redis_client_t *client, const char *job_id, const char *status);
 int redis_get_job_input(redis_client_t *client, const char *job_id, char **input_data_b64);
 int redis_get_job_metadata(redis_client_t *client, const char *job_id, char **metadata_json);
@@ -38,6 +136,31 @@ int redis_store_job_result(redis_client_t *client, const char *job_id, const cha
 int redis_store_job_error(redis_client_t *client, const char *job_id, const char *error_message);
 int redis_update_job_metadata(redis_client_t *client, const char *job_id, const char *metadata_json);
 
+// Fleet telemetry feed: one compact XADD per job plus periodic worker
+// heartbeats into the audio:telemetry stream, capped with MAXLEN ~ so it
+// is a bounded ring the autoscaler and dashboards can tail. Job records
+// carry the queue-aware signals CPU-based autoscaling misses: queue wait
+// (when producers stamp enqueued_at into the metadata), total and
+// per-stage latency, payload size and the worker that ran it. Heartbeats
+// carry in-flight count and arena occupancy per worker.
+//
+// TELEMETRY_MAXLEN overrides the stream cap; 0 disables publishing
+// entirely and both calls become no-ops returning 0.
+int redis_telemetry_enabled(void);
+int redis_telemetry_job(redis_client_t *client, const char *job_id,
+                        const char *hostname, double queue_wait_ms,
+                        double total_ms, size_t payload_bytes,
+                        const char *stages_json, int success);
+int redis_telemetry_heartbeat(redis_client_t *client, const char *hostname,
+                              int threads, int in_flight,
+                              unsigned long long jobs_ok,
+                              unsigned long long jobs_failed,
+                              size_t pool_in_use, size_t pool_capacity);
+
+// Process-wide count of Redis failures (broken connections, error replies);
+// exported by the metrics endpoint
+unsigned long long redis_client_error_count(void);
+
 // Utility functions
 void redis_job_data_init(redis_job_data_t *job_data);
 void redis_job_data_cleanup(redis_job_data_t *job_data);
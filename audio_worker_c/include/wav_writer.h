@@ -33,12 +33,38 @@ typedef struct {
  * @param sample_count Number of samples
  * @param sample_rate Sample rate (e.g., 44100)
  * @param num_channels Number of channels (1 for mono, 2 for stereo)
- * @param wav_data_out Pointer to store allocated WAV data (caller must free)
+ * @param wav_data_out Pointer to store allocated WAV data (caller must pool_free)
  * @param wav_size_out Pointer to store WAV data size
  * @return 0 on success, -1 on error
  */
-int create_wav_file(const int16_t *pcm_data, size_t sample_count, 
+int create_wav_file(const int16_t *pcm_data, size_t sample_count,
                    uint32_t sample_rate, uint16_t num_channels,
                    uint8_t **wav_data_out, size_t *wav_size_out);
 
+/**
+ * Incremental WAV assembly: header size and header writer. Callers that
+ * already own a destination buffer (e.g. the chunked pipeline writing PCM
+ * block by block) write the header once and fill the PCM area in place.
+ */
+size_t wav_header_size(void);
+int wav_write_header(uint8_t *dest, size_t sample_count,
+                     uint32_t sample_rate, uint16_t num_channels);
+
+/**
+ * Allocate a complete WAV image with the header already written and hand
+ * back a pointer to its PCM area, so producers render int16 samples
+ * directly into the framed buffer instead of building the payload
+ * elsewhere and paying a clip-sized copy into a fresh WAV allocation.
+ * @param sample_count Number of samples the PCM area will hold
+ * @param sample_rate Sample rate (e.g., 44100)
+ * @param num_channels Number of channels (1 for mono, 2 for stereo)
+ * @param wav_data_out Pointer to store allocated WAV image (caller must pool_free)
+ * @param wav_size_out Pointer to store WAV image size
+ * @param pcm_out Pointer to store the PCM area inside the image
+ * @return 0 on success, -1 on error
+ */
+int wav_image_create(size_t sample_count, uint32_t sample_rate,
+                     uint16_t num_channels, uint8_t **wav_data_out,
+                     size_t *wav_size_out, int16_t **pcm_out);
+
 #endif // WAV_WRITER_H
\ No newline at end of file
@@ -1,15 +1,18 @@
 #include "audio_processing.h"
+#include "buffer_pool.h"
+#include "fast_math.h"
+#include "parallel.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
 audio_buffer_t* audio_buffer_create(size_t capacity, uint32_t sample_rate, uint16_t channels) {
-    audio_buffer_t *buffer = malloc(sizeof(audio_buffer_t));
+    audio_buffer_t *buffer = pool_malloc(sizeof(audio_buffer_t));
     if (!buffer) return NULL;
     
-    buffer->data = malloc(capacity * sizeof(sample_t));
+    buffer->data = pool_malloc(capacity * sizeof(sample_t));
     if (!buffer->data) {
-        free(buffer);
+        pool_free(buffer);
         return NULL;
     }
     
@@ -26,15 +29,16 @@ audio_buffer_t* audio_buffer_create(size_t capacity, uint32_t sample_rate, uint1
 
 void audio_buffer_destroy(audio_buffer_t *buffer) {
     if (buffer) {
-        free(buffer->data);
-        free(buffer);
+        pool_free(buffer->data);
+        pool_free(buffer);
     }
 }
 
 int audio_buffer_resize(audio_buffer_t *buffer, size_t new_capacity) {
     if (!buffer) return -1;
     
-    sample_t *new_data = realloc(buffer->data, new_capacity * sizeof(sample_t));
+    sample_t *new_data = pool_realloc(buffer->data, buffer->capacity * sizeof(sample_t),
+                                      new_capacity * sizeof(sample_t));
     if (!new_data) return -1;
     
     buffer->data = new_data;
@@ -71,31 +75,67 @@ int audio_buffer_copy(const audio_buffer_t *src, audio_buffer_t *dst) {
     return 0;
 }
 
+// Conversion bodies as parallel_for ranges: large clips are partitioned
+// across cores, small ones run inline through the same code
+typedef struct {
+    const sample_t *in_s16;
+    const float_sample_t *in_f32;
+    sample_t *out_s16;
+    float_sample_t *out_f32;
+    float scale;
+} convert_ctx_t;
+
+static void to_float_range(size_t start, size_t end, int chunk_index, void *arg) {
+    (void)chunk_index;
+    convert_ctx_t *ctx = arg;
+    const float scale = ctx->scale;
+    for (size_t i = start; i < end; i++) {
+        ctx->out_f32[i] = (float)ctx->in_s16[i] * scale;
+    }
+}
+
+static void from_float_range(size_t start, size_t end, int chunk_index, void *arg) {
+    (void)chunk_index;
+    convert_ctx_t *ctx = arg;
+    const float scale = ctx->scale;
+    for (size_t i = start; i < end; i++) {
+        ctx->out_s16[i] = fm_clamp_s16(ctx->in_f32[i] * scale);
+    }
+}
+
 int samples_to_float(const sample_t *input, float_sample_t *output, size_t length) {
     if (!input || !output) return -1;
-    
-    const float scale = 1.0f / 32768.0f;
-    for (size_t i = 0; i < length; i++) {
-        output[i] = (float)input[i] * scale;
-    }
-    
+
+    convert_ctx_t ctx = {0};
+    ctx.in_s16 = input;
+    ctx.out_f32 = output;
+    ctx.scale = 1.0f / 32768.0f;
+    parallel_for(length, PARALLEL_GRAIN_MEMBOUND, to_float_range, &ctx);
+
     return 0;
 }
 
 int samples_from_float(const float_sample_t *input, sample_t *output, size_t length) {
+    return samples_from_float_scaled(input, output, length, 1.0f);
+}
+
+int samples_from_float_scaled(const float_sample_t *input, sample_t *output,
+                              size_t length, float gain) {
     if (!input || !output) return -1;
-    
-    for (size_t i = 0; i < length; i++) {
-        output[i] = clamp_sample(input[i] * 32767.0f);
-    }
-    
+
+    // Gain folds into the quantization scale, so normalizing costs the
+    // same single pass as a plain conversion
+    convert_ctx_t ctx = {0};
+    ctx.in_f32 = input;
+    ctx.out_s16 = output;
+    ctx.scale = 32767.0f * gain;
+    parallel_for(length, PARALLEL_GRAIN_MEMBOUND, from_float_range, &ctx);
+
     return 0;
 }
 
 int16_t clamp_sample(float sample) {
-    if (sample > 32767.0f) return 32767;
-    if (sample < -32768.0f) return -32768;
-    return (int16_t)roundf(sample);
+    return fm_clamp_s16(sample);
 }
 
 float lerp(float a, float b, float t) {
@@ -1,5 +1,9 @@
 #define _USE_MATH_DEFINES
 #include "audio_processing.h"
+#include "buffer_pool.h"
+#include "conv_reverb.h"
+#include "fast_math.h"
+#include "parallel.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -8,256 +12,1007 @@
 #define M_PI 3.14159265358979323846
 #endif
 
-// Simple IIR filter implementation (Butterworth)
+// Cascaded-biquad IIR filter (Butterworth). filter_params_t.order picks
+// the steepness: order N runs N/2 second-order sections, each in
+// transposed direct form II so the per-sample work is two state loads,
+// two stores and five multiply-adds with no history shuffling.
+#define CASCADE_MAX_SECTIONS 8   // caps order at 16 (96 dB/octave)
+#define CASCADE_BLOCK 4096       // keeps the block in L1 across sections
+
+typedef struct {
+    float b0, b1, b2;   // feedforward (a0 normalized out)
+    float a1, a2;       // feedback
+    // Transposed direct form II state, one history pair per channel so
+    // interleaved frames filter independently
+    float z1[AUDIO_MAX_CHANNELS], z2[AUDIO_MAX_CHANNELS];
+} biquad_section_t;
+
 typedef struct {
-    float b[3];  // feedforward coefficients
-    float a[3];  // feedback coefficients
-    float x[3];  // input history
-    float y[3];  // output history
-} biquad_filter_t;
-
-static void biquad_init(biquad_filter_t *filter) {
-    memset(filter->x, 0, sizeof(filter->x));
-    memset(filter->y, 0, sizeof(filter->y));
-}
-
-static float biquad_process(biquad_filter_t *filter, float input) {
-    // Shift history
-    filter->x[2] = filter->x[1];
-    filter->x[1] = filter->x[0];
-    filter->x[0] = input;
-    
-    filter->y[2] = filter->y[1];
-    filter->y[1] = filter->y[0];
-    
-    // Calculate output
-    filter->y[0] = filter->b[0] * filter->x[0] + 
-                   filter->b[1] * filter->x[1] + 
-                   filter->b[2] * filter->x[2] - 
-                   filter->a[1] * filter->y[1] - 
-                   filter->a[2] * filter->y[2];
-    
-    return filter->y[0];
-}
-
-static void calculate_lowpass_coefficients(biquad_filter_t *filter, float freq, float sample_rate) {
+    biquad_section_t sections[CASCADE_MAX_SECTIONS];
+    int num_sections;
+} biquad_cascade_t;
+
+// RBJ coefficients for one second-order section at the given Q
+static void section_coefficients(biquad_section_t *sec, int highpass,
+                                 float freq, float sample_rate, float q) {
     float omega = 2.0f * M_PI * freq / sample_rate;
     float sin_omega = sinf(omega);
     float cos_omega = cosf(omega);
-    float alpha = sin_omega / (2.0f * 0.707f); // Q = 0.707 for Butterworth
-    
+    float alpha = sin_omega / (2.0f * q);
     float a0 = 1.0f + alpha;
-    filter->b[0] = (1.0f - cos_omega) / (2.0f * a0);
-    filter->b[1] = (1.0f - cos_omega) / a0;
-    filter->b[2] = (1.0f - cos_omega) / (2.0f * a0);
-    filter->a[0] = 1.0f;
-    filter->a[1] = (-2.0f * cos_omega) / a0;
-    filter->a[2] = (1.0f - alpha) / a0;
+
+    if (highpass) {
+        sec->b0 = (1.0f + cos_omega) / (2.0f * a0);
+        sec->b1 = -(1.0f + cos_omega) / a0;
+    } else {
+        sec->b0 = (1.0f - cos_omega) / (2.0f * a0);
+        sec->b1 = (1.0f - cos_omega) / a0;
+    }
+    sec->b2 = sec->b0;
+    sec->a1 = (-2.0f * cos_omega) / a0;
+    sec->a2 = (1.0f - alpha) / a0;
+    memset(sec->z1, 0, sizeof(sec->z1));
+    memset(sec->z2, 0, sizeof(sec->z2));
 }
 
-static void calculate_highpass_coefficients(biquad_filter_t *filter, float freq, float sample_rate) {
-    float omega = 2.0f * M_PI * freq / sample_rate;
-    float sin_omega = sinf(omega);
-    float cos_omega = cosf(omega);
-    float alpha = sin_omega / (2.0f * 0.707f); // Q = 0.707 for Butterworth
-    
-    float a0 = 1.0f + alpha;
-    filter->b[0] = (1.0f + cos_omega) / (2.0f * a0);
-    filter->b[1] = -(1.0f + cos_omega) / a0;
-    filter->b[2] = (1.0f + cos_omega) / (2.0f * a0);
-    filter->a[0] = 1.0f;
-    filter->a[1] = (-2.0f * cos_omega) / a0;
-    filter->a[2] = (1.0f - alpha) / a0;
+static void cascade_init(biquad_cascade_t *cascade, int highpass, int order,
+                         float freq, float sample_rate) {
+    // Every section is second order, so odd orders round up to even
+    if (order < 2) order = 2;
+    if (order > 2 * CASCADE_MAX_SECTIONS) order = 2 * CASCADE_MAX_SECTIONS;
+    int sections = (order + 1) / 2;
+    cascade->num_sections = sections;
+
+    // Butterworth pole Qs: the sections share the cutoff and differ only
+    // in Q, spread so the cascade stays maximally flat (order 4 yields
+    // the textbook 0.5412 / 1.3066 pair)
+    for (int k = 0; k < sections; k++) {
+        float q = 1.0f / (2.0f * cosf((float)M_PI * (float)(2 * k + 1) /
+                                      (float)(4 * sections)));
+        section_coefficients(&cascade->sections[k], highpass, freq, sample_rate, q);
+    }
 }
 
-int apply_low_pass_filter(audio_buffer_t *buffer, const filter_params_t *params) {
-    if (!buffer || !params || buffer->length == 0) return -1;
-    
-    // Allocate temporary float buffer
-    float_sample_t *float_samples = malloc(buffer->length * sizeof(float_sample_t));
-    if (!float_samples) return -1;
-    
-    // Convert to float
-    samples_to_float(buffer->data, float_samples, buffer->length);
-    
-    // Create and initialize filter
-    biquad_filter_t filter;
-    calculate_lowpass_coefficients(&filter, params->cutoff_freq, (float)buffer->sample_rate);
-    biquad_init(&filter);
-    
-    // Process samples in-place
-    for (size_t i = 0; i < buffer->length; i++) {
-        float_samples[i] = biquad_process(&filter, float_samples[i]);
+// Section-outer, sample-inner over L1-sized blocks: each section's five
+// coefficients and state live in registers for a whole block, and
+// consecutive sections reread the block while it is still cache-hot.
+// Blocks are trimmed to frame boundaries so each channel always sees its
+// own history slot.
+static void cascade_process(biquad_cascade_t *cascade,
+                            float_sample_t *samples, size_t length,
+                            uint16_t channels) {
+    size_t block_len = CASCADE_BLOCK - CASCADE_BLOCK % channels;
+
+    for (size_t start = 0; start < length; start += block_len) {
+        size_t n = length - start;
+        if (n > block_len) n = block_len;
+        float_sample_t *block = samples + start;
+
+        for (int s = 0; s < cascade->num_sections; s++) {
+            biquad_section_t *sec = &cascade->sections[s];
+            float b0 = sec->b0, b1 = sec->b1, b2 = sec->b2;
+            float a1 = sec->a1, a2 = sec->a2;
+
+            if (channels == 1) {
+                float z1 = sec->z1[0], z2 = sec->z2[0];
+
+                for (size_t i = 0; i < n; i++) {
+                    float x = block[i];
+                    float y = b0 * x + z1;
+                    z1 = b1 * x - a1 * y + z2;
+                    z2 = b2 * x - a2 * y;
+                    block[i] = y;
+                }
+
+                sec->z1[0] = z1;
+                sec->z2[0] = z2;
+            } else {
+                // Channel-inner over one interleaved frame: the channels
+                // are independent recurrences on adjacent samples, which
+                // is exactly the layout the vectorizer wants
+                float z1[AUDIO_MAX_CHANNELS], z2[AUDIO_MAX_CHANNELS];
+                memcpy(z1, sec->z1, sizeof(z1));
+                memcpy(z2, sec->z2, sizeof(z2));
+
+                for (size_t i = 0; i < n; i += channels) {
+                    for (uint16_t c = 0; c < channels; c++) {
+                        float x = block[i + c];
+                        float y = b0 * x + z1[c];
+                        z1[c] = b1 * x - a1 * y + z2[c];
+                        z2[c] = b2 * x - a2 * y;
+                        block[i + c] = y;
+                    }
+                }
+
+                memcpy(sec->z1, z1, sizeof(z1));
+                memcpy(sec->z2, z2, sizeof(z2));
+            }
+        }
     }
-    
-    // Convert back to int16
-    samples_from_float(float_samples, buffer->data, buffer->length);
-    
-    free(float_samples);
+}
+
+// Float-domain kernels. These process in-place on the shared float buffer
+// owned by the fused pipeline, so chaining effects costs no conversions
+// or clip-sized allocations between stages.
+
+int effect_low_pass_f(float_sample_t *samples, size_t length,
+                      uint32_t sample_rate, uint16_t channels,
+                      const filter_params_t *params) {
+    if (!samples || !params || length == 0) return -1;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return -1;
+
+    biquad_cascade_t cascade;
+    cascade_init(&cascade, 0, params->order, params->cutoff_freq, (float)sample_rate);
+    cascade_process(&cascade, samples, length, channels);
+
     return 0;
 }
 
-int apply_high_pass_filter(audio_buffer_t *buffer, const filter_params_t *params) {
-    if (!buffer || !params || buffer->length == 0) return -1;
-    
-    // Allocate temporary float buffer
-    float_sample_t *float_samples = malloc(buffer->length * sizeof(float_sample_t));
-    if (!float_samples) return -1;
-    
-    // Convert to float
-    samples_to_float(buffer->data, float_samples, buffer->length);
-    
-    // Create and initialize filter
-    biquad_filter_t filter;
-    calculate_highpass_coefficients(&filter, params->cutoff_freq, (float)buffer->sample_rate);
-    biquad_init(&filter);
-    
-    // Process samples in-place
-    for (size_t i = 0; i < buffer->length; i++) {
-        float_samples[i] = biquad_process(&filter, float_samples[i]);
-    }
-    
-    // Convert back to int16
-    samples_from_float(float_samples, buffer->data, buffer->length);
-    
-    free(float_samples);
+int effect_high_pass_f(float_sample_t *samples, size_t length,
+                       uint32_t sample_rate, uint16_t channels,
+                       const filter_params_t *params) {
+    if (!samples || !params || length == 0) return -1;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return -1;
+
+    biquad_cascade_t cascade;
+    cascade_init(&cascade, 1, params->order, params->cutoff_freq, (float)sample_rate);
+    cascade_process(&cascade, samples, length, channels);
+
     return 0;
 }
 
-int apply_reverb(audio_buffer_t *buffer, const reverb_params_t *params) {
-    if (!buffer || !params || buffer->length == 0) return -1;
-    
-    // Simple reverb using comb filters and allpass filters
-    size_t delay_samples = (size_t)(params->room_size * buffer->sample_rate * 0.1f); // Max 100ms delay
-    if (delay_samples >= buffer->length) delay_samples = buffer->length / 4;
-    
+int effect_reverb_f(float_sample_t *samples, size_t length,
+                    uint32_t sample_rate, uint16_t channels,
+                    const reverb_params_t *params) {
+    if (!samples || !params || length == 0) return -1;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return -1;
+
+    size_t frames = length / channels;
+
+    // Partitioned FFT convolution engine: real room tails (seconds, not
+    // the comb filter's 100ms ceiling) at O(n log n) in tail length
+    if (params->use_convolution) {
+        if (channels == 1) {
+            conv_reverb_t *conv = conv_reverb_create(params, sample_rate);
+            if (!conv) return -1;
+            int result = conv_reverb_process(conv, samples, length);
+            conv_reverb_destroy(conv);
+            return result;
+        }
+
+        // The FFT engine's overlap history must not mix channels, so each
+        // channel runs its own engine over a deinterleaved copy
+        float_sample_t *mono = pool_malloc(frames * sizeof(float_sample_t));
+        if (!mono) return -1;
+
+        int result = 0;
+        for (uint16_t c = 0; c < channels && result == 0; c++) {
+            conv_reverb_t *conv = conv_reverb_create(params, sample_rate);
+            if (!conv) {
+                result = -1;
+                break;
+            }
+            for (size_t f = 0; f < frames; f++) {
+                mono[f] = samples[f * channels + c];
+            }
+            result = conv_reverb_process(conv, mono, frames);
+            if (result == 0) {
+                for (size_t f = 0; f < frames; f++) {
+                    samples[f * channels + c] = mono[f];
+                }
+            }
+            conv_reverb_destroy(conv);
+        }
+
+        pool_free(mono);
+        return result;
+    }
+
+    // Simple reverb using comb filters and allpass filters. The delay is
+    // computed in frames and scaled to interleaved samples: the line
+    // length is then a frame multiple, so a cursor advancing one sample
+    // per sample keeps every slot on its own channel.
+    size_t delay_frames = (size_t)(params->room_size * sample_rate * 0.1f); // Max 100ms delay
+    if (delay_frames >= frames) delay_frames = frames / 4;
+    if (delay_frames == 0) return 0;
+    size_t delay_samples = delay_frames * channels;
+
     // Allocate delay line
-    float_sample_t *delay_line = calloc(delay_samples, sizeof(float_sample_t));
+    float_sample_t *delay_line = pool_calloc(delay_samples, sizeof(float_sample_t));
     if (!delay_line) return -1;
-    
-    // Allocate temporary float buffer
-    float_sample_t *float_samples = malloc(buffer->length * sizeof(float_sample_t));
-    if (!float_samples) {
-        free(delay_line);
-        return -1;
-    }
-    
-    // Convert to float
-    samples_to_float(buffer->data, float_samples, buffer->length);
-    
+
     size_t delay_index = 0;
     float feedback = params->damping * 0.5f;
-    
+
     // Process samples
-    for (size_t i = 0; i < buffer->length; i++) {
+    for (size_t i = 0; i < length; i++) {
         float delayed = delay_line[delay_index];
-        float input_with_feedback = float_samples[i] + delayed * feedback;
-        
+        float input_with_feedback = samples[i] + delayed * feedback;
+
         // Update delay line
         delay_line[delay_index] = input_with_feedback;
         delay_index = (delay_index + 1) % delay_samples;
-        
+
         // Mix dry and wet signals
-        float_samples[i] = float_samples[i] * (1.0f - params->wet_level) + 
-                          delayed * params->wet_level;
-    }
-    
-    // Convert back to int16
-    samples_from_float(float_samples, buffer->data, buffer->length);
-    
-    free(float_samples);
-    free(delay_line);
+        samples[i] = samples[i] * (1.0f - params->wet_level) +
+                     delayed * params->wet_level;
+    }
+
+    pool_free(delay_line);
     return 0;
 }
 
-int apply_echo(audio_buffer_t *buffer, const echo_params_t *params) {
-    if (!buffer || !params || buffer->length == 0) return -1;
-    
-    size_t delay_samples = (size_t)(params->delay_ms * buffer->sample_rate / 1000.0f);
-    if (delay_samples >= buffer->length) return -1;
-    
-    // Allocate temporary buffer for echo
-    sample_t *echo_buffer = calloc(buffer->length, sizeof(sample_t));
-    if (!echo_buffer) return -1;
-    
-    // Generate echo
-    for (int echo = 0; echo < params->num_echoes && echo < 5; echo++) {
-        size_t current_delay = delay_samples * (echo + 1);
-        if (current_delay >= buffer->length) break;
-        
-        float amplitude = powf(params->decay, echo + 1);
-        
-        for (size_t i = current_delay; i < buffer->length; i++) {
-            float echo_sample = (float)buffer->data[i - current_delay] * amplitude;
-            echo_buffer[i] += clamp_sample(echo_sample);
+int effect_echo_f(float_sample_t *samples, size_t length,
+                  uint32_t sample_rate, uint16_t channels,
+                  const echo_params_t *params) {
+    if (!samples || !params || length == 0) return -1;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return -1;
+
+    size_t frames = length / channels;
+    size_t delay_frames = (size_t)(params->delay_ms * sample_rate / 1000.0f);
+    if (delay_frames >= frames) return -1;
+
+    int num_echoes = params->num_echoes < 5 ? params->num_echoes : 5;
+    if (num_echoes < 1 || delay_frames == 0) return 0;
+
+    // Tap distances scale to interleaved samples; the window stays a frame
+    // multiple so the trailing cursors never cross channels
+    size_t delay_samples = delay_frames * channels;
+
+    // Single-pass multi-tap engine: a circular dry-history window sized to
+    // the farthest tap replaces the clip-length accumulation buffer and
+    // the per-tap passes, so the clip is traversed once regardless of tap
+    // count and all mixing stays in float.
+    size_t window = delay_samples * (size_t)num_echoes;
+    float_sample_t *delay_line = pool_calloc(window, sizeof(float_sample_t));
+    if (!delay_line) return -1;
+
+    // Per-tap gains (decay^1 .. decay^n) and read cursors; each cursor
+    // trails the write cursor by its tap distance and wraps on its own,
+    // so the inner loop has no modulo
+    float gains[5];
+    size_t read_idx[5];
+    float amplitude = 1.0f;
+    for (int e = 0; e < num_echoes; e++) {
+        amplitude *= params->decay;
+        gains[e] = amplitude;
+        read_idx[e] = window - delay_samples * (size_t)(e + 1);
+        if (read_idx[e] == window) read_idx[e] = 0;
+    }
+
+    size_t write_idx = 0;
+    for (size_t i = 0; i < length; i++) {
+        float dry = samples[i];
+        float wet = 0.0f;
+
+        for (int e = 0; e < num_echoes; e++) {
+            wet += delay_line[read_idx[e]] * gains[e];
+            read_idx[e]++;
+            if (read_idx[e] == window) read_idx[e] = 0;
+        }
+
+        delay_line[write_idx] = dry;
+        write_idx++;
+        if (write_idx == window) write_idx = 0;
+
+        samples[i] = dry + wet * 0.5f;
+    }
+
+    pool_free(delay_line);
+    return 0;
+}
+
+// WSOLA pitch shifter. Duration is preserved: the clip is first
+// time-stretched by the pitch factor with waveform-similarity overlap-add
+// (Hann-windowed frames, cross-correlation search for the best-aligned
+// analysis position), then linearly resampled back to the original
+// length, which applies the pitch change. The overlap-add, correlation
+// and resampling loops all run over contiguous float blocks without
+// per-sample branches so the compiler can vectorize them.
+#define WSOLA_FRAME  2048                // analysis/synthesis frame
+#define WSOLA_HOP    (WSOLA_FRAME / 2)   // 50% overlap
+#define WSOLA_SEARCH 256                 // correlation search radius
+#define WSOLA_STEP   4                   // candidate stride in the search
+#define WSOLA_CORR   256                 // samples compared per candidate
+
+static float segment_correlation(const float *a, const float *b, size_t n) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < n; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+static int pitch_shift_mono(float_sample_t *samples, size_t length,
+                            float shift_factor) {
+    // Clips too short for a few WSOLA frames fall back to a plain linear
+    // resample (duration kept; the tail is truncated or zero-padded)
+    if (length < 4 * WSOLA_FRAME) {
+        float_sample_t *temp_buffer = pool_malloc(length * sizeof(float_sample_t));
+        if (!temp_buffer) return -1;
+
+        for (size_t i = 0; i < length; i++) {
+            float src_pos = (float)i * shift_factor;
+            size_t src_index = (size_t)src_pos;
+            float frac = src_pos - src_index;
+            float s0 = src_index < length ? samples[src_index] : 0.0f;
+            float s1 = src_index + 1 < length ? samples[src_index + 1] : 0.0f;
+            temp_buffer[i] = lerp(s0, s1, frac);
         }
+
+        memcpy(samples, temp_buffer, length * sizeof(float_sample_t));
+        pool_free(temp_buffer);
+        return 0;
     }
-    
-    // Mix original with echo
-    for (size_t i = 0; i < buffer->length; i++) {
-        float mixed = (float)buffer->data[i] + (float)echo_buffer[i] * 0.5f;
-        buffer->data[i] = clamp_sample(mixed);
+
+    // Stage 1: time-stretch by shift_factor with WSOLA
+    size_t stretched_len = (size_t)((double)length * shift_factor) + WSOLA_FRAME;
+    float *stretched = pool_calloc(stretched_len, sizeof(float));
+    float *norm = pool_calloc(stretched_len, sizeof(float));
+    float *window = pool_malloc(WSOLA_FRAME * sizeof(float));
+    if (!stretched || !norm || !window) {
+        pool_free(stretched);
+        pool_free(norm);
+        pool_free(window);
+        return -1;
     }
-    
-    free(echo_buffer);
+
+    for (size_t i = 0; i < WSOLA_FRAME; i++) {
+        window[i] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * (float)i / (WSOLA_FRAME - 1));
+    }
+
+    size_t max_src = length - WSOLA_FRAME;
+    size_t prev_src = 0;
+
+    for (size_t out_pos = 0; out_pos + WSOLA_FRAME <= stretched_len; out_pos += WSOLA_HOP) {
+        size_t src = 0;
+
+        if (out_pos > 0) {
+            // The natural continuation of the previous frame is the
+            // similarity template; search around the nominal analysis
+            // position for the candidate that best matches it in phase
+            size_t natural = prev_src + WSOLA_HOP;
+            if (natural > max_src) natural = max_src;
+            const float *template_seg = samples + natural;
+
+            long nominal = (long)((double)out_pos / shift_factor);
+            long lo = nominal - WSOLA_SEARCH;
+            long hi = nominal + WSOLA_SEARCH;
+            if (lo < 0) lo = 0;
+            if (hi > (long)max_src) hi = (long)max_src;
+
+            float best_corr = -1e30f;
+            src = (size_t)lo;
+            for (long cand = lo; cand <= hi; cand += WSOLA_STEP) {
+                float corr = segment_correlation(template_seg, samples + cand, WSOLA_CORR);
+                if (corr > best_corr) {
+                    best_corr = corr;
+                    src = (size_t)cand;
+                }
+            }
+        }
+
+        const float *frame = samples + src;
+        float *out = stretched + out_pos;
+        float *out_norm = norm + out_pos;
+        for (size_t i = 0; i < WSOLA_FRAME; i++) {
+            out[i] += frame[i] * window[i];
+            out_norm[i] += window[i];
+        }
+
+        prev_src = src;
+    }
+
+    for (size_t i = 0; i < stretched_len; i++) {
+        if (norm[i] > 1e-6f) stretched[i] /= norm[i];
+    }
+
+    // Stage 2: resample the stretched signal back to the original length.
+    // Reading at shift_factor rate undoes the stretch and applies the
+    // pitch change; the main loop is bounds-check free
+    size_t safe_len = (size_t)((double)(stretched_len - 1) / shift_factor);
+    if (safe_len > length) safe_len = length;
+
+    for (size_t i = 0; i < safe_len; i++) {
+        double src_pos = (double)i * shift_factor;
+        size_t src_index = (size_t)src_pos;
+        float frac = (float)(src_pos - src_index);
+        samples[i] = lerp(stretched[src_index], stretched[src_index + 1], frac);
+    }
+    for (size_t i = safe_len; i < length; i++) {
+        double src_pos = (double)i * shift_factor;
+        size_t src_index = (size_t)src_pos;
+        samples[i] = src_index < stretched_len ? stretched[src_index] : 0.0f;
+    }
+
+    pool_free(stretched);
+    pool_free(norm);
+    pool_free(window);
     return 0;
 }
 
-int apply_pitch_shift(audio_buffer_t *buffer, const pitch_params_t *params) {
-    if (!buffer || !params || buffer->length == 0) return -1;
-    
+int effect_pitch_shift_f(float_sample_t *samples, size_t length,
+                         uint16_t channels, const pitch_params_t *params) {
+    if (!samples || !params || length == 0) return -1;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return -1;
+
     float shift_factor = powf(2.0f, params->semitones / 12.0f);
-    
-    // Allocate temporary buffer
-    sample_t *temp_buffer = malloc(buffer->length * sizeof(sample_t));
-    if (!temp_buffer) return -1;
-    
-    // Simple pitch shift using linear interpolation
-    for (size_t i = 0; i < buffer->length; i++) {
-        float src_pos = (float)i / shift_factor;
-        size_t src_index = (size_t)src_pos;
-        float frac = src_pos - src_index;
-        
-        if (src_index + 1 < buffer->length) {
-            float sample1 = (float)buffer->data[src_index];
-            float sample2 = (float)buffer->data[src_index + 1];
-            temp_buffer[i] = clamp_sample(lerp(sample1, sample2, frac));
-        } else if (src_index < buffer->length) {
-            temp_buffer[i] = buffer->data[src_index];
-        } else {
-            temp_buffer[i] = 0;
+    if (fabsf(shift_factor - 1.0f) < 1e-4f) return 0;
+
+    if (channels == 1) {
+        return pitch_shift_mono(samples, length, shift_factor);
+    }
+
+    // The WSOLA correlation search is meaningless across interleaved
+    // frames, so each channel is shifted on its own deinterleaved copy
+    size_t frames = length / channels;
+    float_sample_t *mono = pool_malloc(frames * sizeof(float_sample_t));
+    if (!mono) return -1;
+
+    int result = 0;
+    for (uint16_t c = 0; c < channels && result == 0; c++) {
+        for (size_t f = 0; f < frames; f++) {
+            mono[f] = samples[f * channels + c];
+        }
+        result = pitch_shift_mono(mono, frames, shift_factor);
+        if (result == 0) {
+            for (size_t f = 0; f < frames; f++) {
+                samples[f * channels + c] = mono[f];
+            }
         }
     }
-    
-    // Copy back to original buffer
-    memcpy(buffer->data, temp_buffer, buffer->length * sizeof(sample_t));
-    
-    free(temp_buffer);
+
+    pool_free(mono);
+    return result;
+}
+
+typedef struct {
+    float_sample_t *samples;
+    const distortion_params_t *params;
+} distortion_ctx_t;
+
+static void distortion_range(size_t start, size_t end, int chunk_index, void *arg) {
+    (void)chunk_index;
+    distortion_ctx_t *ctx = arg;
+
+    // Soft clipping using tanh: tanh(x * gain * threshold) / threshold
+    // with both scales folded into the polynomial block, which the
+    // compiler vectorizes - per-sample libm tanhf dominated this effect
+    fm_tanh_scale_block(ctx->samples + start, end - start,
+                        ctx->params->gain * ctx->params->threshold,
+                        1.0f / ctx->params->threshold);
+}
+
+int effect_distortion_f(float_sample_t *samples, size_t length,
+                        const distortion_params_t *params) {
+    if (!samples || !params || length == 0) return -1;
+
+    // Per-sample tanh is the most compute-heavy stage, so it amortizes
+    // the fork/join earliest of any of the parallel sweeps
+    distortion_ctx_t ctx = { samples, params };
+    parallel_for(length, PARALLEL_GRAIN_COMPUTE, distortion_range, &ctx);
+
     return 0;
 }
 
-int apply_distortion(audio_buffer_t *buffer, const distortion_params_t *params) {
-    if (!buffer || !params || buffer->length == 0) return -1;
-    
-    // Apply soft clipping distortion
-    for (size_t i = 0; i < buffer->length; i++) {
-        float sample = (float)buffer->data[i] / 32768.0f;
-        
-        // Apply gain
-        sample *= params->gain;
-        
-        // Soft clipping using tanh
-        sample = tanhf(sample * params->threshold) / params->threshold;
-        
-        buffer->data[i] = clamp_sample(sample * 32767.0f);
-    }
-    
+typedef struct {
+    const float_sample_t *samples;
+    float partial[PARALLEL_MAX_THREADS];
+} peak_ctx_t;
+
+static void peak_range(size_t start, size_t end, int chunk_index, void *arg) {
+    peak_ctx_t *ctx = arg;
+    const float_sample_t *samples = ctx->samples;
+    float peak = 0.0f;
+    for (size_t i = start; i < end; i++) {
+        float abs_val = fabsf(samples[i]);
+        peak = abs_val > peak ? abs_val : peak;
+    }
+    ctx->partial[chunk_index] = peak;
+}
+
+// Branch-free max-abs reduction; fabsf and the running max both map to
+// single vector instructions, so each chunk runs at memory bandwidth
+float audio_peak_f(const float_sample_t *samples, size_t length) {
+    peak_ctx_t ctx;
+    ctx.samples = samples;
+
+    int chunks = parallel_for(length, PARALLEL_GRAIN_MEMBOUND, peak_range, &ctx);
+
+    float peak = 0.0f;
+    for (int i = 0; i < chunks; i++) {
+        peak = ctx.partial[i] > peak ? ctx.partial[i] : peak;
+    }
+    return peak;
+}
+
+int normalize_audio_f(float_sample_t *samples, size_t length) {
+    if (!samples || length == 0) return -1;
+
+    float peak = audio_peak_f(samples, length);
+    if (peak == 0.0f) return 0; // Silent audio
+
+    // Only scale down if over the headroom target
+    if (peak > 0.95f) {
+        float scale = 0.95f / peak;
+        for (size_t i = 0; i < length; i++) {
+            samples[i] *= scale;
+        }
+    }
+
     return 0;
 }
 
+// Chunked (streaming) processing: persistent effect state carried across
+// blocks. Reverb and echo keep circular delay lines sized to their tail,
+// the filters keep biquad history, and the running peak feeds a deferred
+// normalization pass over the finished output.
+
+struct audio_stream_state {
+    uint32_t effects_mask;
+    uint16_t channels;
+
+    biquad_cascade_t low_pass;
+    biquad_cascade_t high_pass;
+
+    // Reverb: either the convolution engines (one per channel - the FFT
+    // overlap history must not mix channels) or the comb filter's delay
+    // line, which handles interleaving by construction
+    conv_reverb_t *reverb_conv[AUDIO_MAX_CHANNELS];
+    float_sample_t *conv_scratch;      // deinterleave staging, grown lazily
+    size_t conv_scratch_frames;
+    float_sample_t *reverb_delay;
+    size_t reverb_delay_samples;
+    size_t reverb_index;
+    float reverb_feedback;
+    float reverb_wet;
+
+    // Echo dry-history delay line (num_echoes * delay samples)
+    float_sample_t *echo_delay;
+    size_t echo_delay_len;
+    size_t echo_index;
+    size_t echo_delay_samples;
+    int echo_num_echoes;
+    float echo_decay;
+
+    distortion_params_t distortion;
+
+    float peak;
+};
+
+int audio_stream_supported(uint32_t effects_mask) {
+    // Pitch shift needs lookahead over the whole clip; everything else is
+    // causal with bounded state
+    return (effects_mask & EFFECT_PITCH_SHIFT) == 0;
+}
+
+audio_stream_state_t* audio_stream_state_create(const audio_job_t *job,
+                                                uint32_t sample_rate,
+                                                uint16_t channels) {
+    if (!job || !audio_stream_supported(job->effects_mask)) return NULL;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return NULL;
+
+    audio_stream_state_t *state = pool_calloc(1, sizeof(audio_stream_state_t));
+    if (!state) return NULL;
+
+    state->effects_mask = job->effects_mask;
+    state->channels = channels;
+
+    if (job->effects_mask & EFFECT_LOW_PASS) {
+        cascade_init(&state->low_pass, 0, job->low_pass.order,
+                     job->low_pass.cutoff_freq, (float)sample_rate);
+    }
+
+    if (job->effects_mask & EFFECT_HIGH_PASS) {
+        cascade_init(&state->high_pass, 1, job->high_pass.order,
+                     job->high_pass.cutoff_freq, (float)sample_rate);
+    }
+
+    if ((job->effects_mask & EFFECT_REVERB) && job->reverb.use_convolution) {
+        for (uint16_t c = 0; c < channels; c++) {
+            state->reverb_conv[c] = conv_reverb_create(&job->reverb, sample_rate);
+            if (!state->reverb_conv[c]) {
+                audio_stream_state_destroy(state);
+                return NULL;
+            }
+        }
+    } else if (job->effects_mask & EFFECT_REVERB) {
+        size_t delay_frames = (size_t)(job->reverb.room_size * sample_rate * 0.1f);
+        if (delay_frames == 0) delay_frames = 1;
+        state->reverb_delay_samples = delay_frames * channels;
+        state->reverb_delay = pool_calloc(state->reverb_delay_samples, sizeof(float_sample_t));
+        if (!state->reverb_delay) {
+            audio_stream_state_destroy(state);
+            return NULL;
+        }
+        state->reverb_feedback = job->reverb.damping * 0.5f;
+        state->reverb_wet = job->reverb.wet_level;
+    }
+
+    if (job->effects_mask & EFFECT_ECHO) {
+        state->echo_delay_samples = (size_t)(job->echo.delay_ms * sample_rate / 1000.0f) * channels;
+        state->echo_num_echoes = job->echo.num_echoes < 5 ? job->echo.num_echoes : 5;
+        state->echo_decay = job->echo.decay;
+        state->echo_delay_len = state->echo_delay_samples * state->echo_num_echoes;
+        if (state->echo_delay_len > 0) {
+            state->echo_delay = pool_calloc(state->echo_delay_len, sizeof(float_sample_t));
+            if (!state->echo_delay) {
+                audio_stream_state_destroy(state);
+                return NULL;
+            }
+        }
+    }
+
+    state->distortion = job->distortion;
+    state->peak = 0.0f;
+
+    return state;
+}
+
+void audio_stream_state_destroy(audio_stream_state_t *state) {
+    if (!state) return;
+    for (int c = 0; c < AUDIO_MAX_CHANNELS; c++) {
+        conv_reverb_destroy(state->reverb_conv[c]);
+    }
+    pool_free(state->conv_scratch);
+    pool_free(state->reverb_delay);
+    pool_free(state->echo_delay);
+    pool_free(state);
+}
+
+int audio_stream_process_block(audio_stream_state_t *state,
+                               float_sample_t *samples, size_t length) {
+    if (!state || !samples) return -1;
+    if (length == 0) return 0;
+
+    if (state->effects_mask & EFFECT_LOW_PASS) {
+        cascade_process(&state->low_pass, samples, length, state->channels);
+    }
+
+    if (state->effects_mask & EFFECT_HIGH_PASS) {
+        cascade_process(&state->high_pass, samples, length, state->channels);
+    }
+
+    if (state->reverb_conv[0] && state->channels == 1) {
+        conv_reverb_process(state->reverb_conv[0], samples, length);
+    } else if (state->reverb_conv[0]) {
+        // Per-channel convolution over deinterleaved frames; the staging
+        // buffer grows to the largest block seen and is then reused
+        size_t frames = length / state->channels;
+        if (frames > state->conv_scratch_frames) {
+            pool_free(state->conv_scratch);
+            state->conv_scratch = pool_malloc(frames * sizeof(float_sample_t));
+            if (!state->conv_scratch) {
+                state->conv_scratch_frames = 0;
+                return -1;
+            }
+            state->conv_scratch_frames = frames;
+        }
+
+        float_sample_t *mono = state->conv_scratch;
+        for (uint16_t c = 0; c < state->channels; c++) {
+            for (size_t f = 0; f < frames; f++) {
+                mono[f] = samples[f * state->channels + c];
+            }
+            if (conv_reverb_process(state->reverb_conv[c], mono, frames) != 0) {
+                return -1;
+            }
+            for (size_t f = 0; f < frames; f++) {
+                samples[f * state->channels + c] = mono[f];
+            }
+        }
+    } else if (state->effects_mask & EFFECT_REVERB) {
+        float_sample_t *delay_line = state->reverb_delay;
+        size_t delay_samples = state->reverb_delay_samples;
+        size_t delay_index = state->reverb_index;
+        float feedback = state->reverb_feedback;
+        float wet = state->reverb_wet;
+
+        for (size_t i = 0; i < length; i++) {
+            float delayed = delay_line[delay_index];
+            delay_line[delay_index] = samples[i] + delayed * feedback;
+            delay_index = (delay_index + 1) % delay_samples;
+            samples[i] = samples[i] * (1.0f - wet) + delayed * wet;
+        }
+        state->reverb_index = delay_index;
+    }
+
+    if ((state->effects_mask & EFFECT_ECHO) && state->echo_delay_len > 0) {
+        float_sample_t *delay_line = state->echo_delay;
+        size_t delay_len = state->echo_delay_len;
+        size_t index = state->echo_index;
+
+        for (size_t i = 0; i < length; i++) {
+            float dry = samples[i];
+            float wet = 0.0f;
+            float amplitude = 1.0f;
+
+            for (int echo = 1; echo <= state->echo_num_echoes; echo++) {
+                size_t tap = echo * state->echo_delay_samples;
+                amplitude *= state->echo_decay;
+                wet += delay_line[(index + delay_len - tap) % delay_len] * amplitude;
+            }
+
+            delay_line[index] = dry;
+            index = (index + 1) % delay_len;
+            samples[i] = dry + wet * 0.5f;
+        }
+        state->echo_index = index;
+    }
+
+    if (state->effects_mask & EFFECT_DISTORTION) {
+        effect_distortion_f(samples, length, &state->distortion);
+    }
+
+    // Running peak for the deferred normalization pass
+    float peak = state->peak;
+    for (size_t i = 0; i < length; i++) {
+        float abs_val = fabsf(samples[i]);
+        if (abs_val > peak) peak = abs_val;
+    }
+    state->peak = peak;
+
+    return 0;
+}
+
+float audio_stream_peak(const audio_stream_state_t *state) {
+    return state ? state->peak : 0.0f;
+}
+
+// Compile-time specialized fused kernels for the hot effect chains. The
+// generic pipeline walks the whole clip once per effect plus conversion
+// and peak passes; for the few masks that dominate production traffic a
+// single loop applies input conversion, the filter cascades, the reverb
+// comb and the peak scan per sample while it is still in registers, so
+// the clip crosses memory once instead of once per stage. fused_run is
+// instantiated per hot mask with a constant mask argument, letting the
+// compiler delete every disabled branch outright; chains that match no
+// instantiation fall back to the generic multi-pass path.
+
+typedef struct {
+    uint16_t channels;
+    biquad_cascade_t low_pass;
+    biquad_cascade_t high_pass;
+    float_sample_t *reverb_delay;
+    size_t reverb_delay_samples;
+    size_t reverb_index;
+    float reverb_feedback;
+    float reverb_wet;
+    float peak;
+} fused_state_t;
+
+static inline float fused_step(uint32_t mask, fused_state_t *st, float x, uint16_t c) {
+    if (mask & EFFECT_HIGH_PASS) {
+        biquad_cascade_t *f = &st->high_pass;
+        for (int s = 0; s < f->num_sections; s++) {
+            biquad_section_t *sec = &f->sections[s];
+            float y = sec->b0 * x + sec->z1[c];
+            sec->z1[c] = sec->b1 * x - sec->a1 * y + sec->z2[c];
+            sec->z2[c] = sec->b2 * x - sec->a2 * y;
+            x = y;
+        }
+    }
+
+    if (mask & EFFECT_LOW_PASS) {
+        biquad_cascade_t *f = &st->low_pass;
+        for (int s = 0; s < f->num_sections; s++) {
+            biquad_section_t *sec = &f->sections[s];
+            float y = sec->b0 * x + sec->z1[c];
+            sec->z1[c] = sec->b1 * x - sec->a1 * y + sec->z2[c];
+            sec->z2[c] = sec->b2 * x - sec->a2 * y;
+            x = y;
+        }
+    }
+
+    if (mask & EFFECT_REVERB) {
+        float delayed = st->reverb_delay[st->reverb_index];
+        st->reverb_delay[st->reverb_index] = x + delayed * st->reverb_feedback;
+        st->reverb_index++;
+        if (st->reverb_index == st->reverb_delay_samples) st->reverb_index = 0;
+        x = x * (1.0f - st->reverb_wet) + delayed * st->reverb_wet;
+    }
+
+    return x;
+}
+
+static inline void fused_run(uint32_t mask, fused_state_t *st,
+                             const sample_t *input, sample_t *output,
+                             size_t length) {
+    const float in_scale = 1.0f / 32768.0f;
+    const uint16_t channels = st->channels;
+    float peak = st->peak;
+    uint16_t c = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        float x = (float)input[i] * in_scale;
+        x = fused_step(mask, st, x, c);
+        c++;
+        if (c == channels) c = 0;
+
+        float abs_val = fabsf(x);
+        peak = abs_val > peak ? abs_val : peak;
+        output[i] = fm_clamp_s16(x * 32767.0f);
+    }
+
+    st->peak = peak;
+}
+
+// One instantiation per hot mask; the constant propagates into fused_run
+// and fused_step so each body contains only its own chain
+static void fused_run_lp_reverb(fused_state_t *st, const sample_t *in,
+                                sample_t *out, size_t n) {
+    fused_run(EFFECT_LOW_PASS | EFFECT_REVERB, st, in, out, n);
+}
+
+static void fused_run_lp(fused_state_t *st, const sample_t *in,
+                         sample_t *out, size_t n) {
+    fused_run(EFFECT_LOW_PASS, st, in, out, n);
+}
+
+static void fused_run_hp_lp(fused_state_t *st, const sample_t *in,
+                            sample_t *out, size_t n) {
+    fused_run(EFFECT_HIGH_PASS | EFFECT_LOW_PASS, st, in, out, n);
+}
+
+int audio_fused_supported(const audio_job_t *job) {
+    if (!job) return 0;
+
+    switch (job->effects_mask) {
+    case EFFECT_LOW_PASS | EFFECT_REVERB:
+        // The convolution engine is not a per-sample recurrence
+        return !job->reverb.use_convolution;
+    case EFFECT_LOW_PASS:
+    case EFFECT_HIGH_PASS | EFFECT_LOW_PASS:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+int audio_fused_process(const audio_job_t *job, const sample_t *input,
+                        sample_t *output, size_t length,
+                        uint32_t sample_rate, uint16_t channels,
+                        float *peak_out) {
+    if (!job || !input || !output || !peak_out || length == 0) return 0;
+    if (channels < 1 || channels > AUDIO_MAX_CHANNELS) return 0;
+    if (!audio_fused_supported(job)) return 0;
+
+    void (*kernel)(fused_state_t *, const sample_t *, sample_t *, size_t);
+    switch (job->effects_mask) {
+    case EFFECT_LOW_PASS | EFFECT_REVERB:
+        kernel = fused_run_lp_reverb;
+        break;
+    case EFFECT_LOW_PASS:
+        kernel = fused_run_lp;
+        break;
+    default:
+        kernel = fused_run_hp_lp;
+        break;
+    }
+
+    fused_state_t st = {0};
+    st.channels = channels;
+
+    if (job->effects_mask & EFFECT_LOW_PASS) {
+        cascade_init(&st.low_pass, 0, job->low_pass.order,
+                     job->low_pass.cutoff_freq, (float)sample_rate);
+    }
+    if (job->effects_mask & EFFECT_HIGH_PASS) {
+        cascade_init(&st.high_pass, 1, job->high_pass.order,
+                     job->high_pass.cutoff_freq, (float)sample_rate);
+    }
+    if (job->effects_mask & EFFECT_REVERB) {
+        // Same delay sizing as effect_reverb_f so the fused and generic
+        // paths render the same comb
+        size_t frames = length / channels;
+        size_t delay_frames = (size_t)(job->reverb.room_size * sample_rate * 0.1f);
+        if (delay_frames >= frames) delay_frames = frames / 4;
+        if (delay_frames == 0) return 0;   // degenerate clip; generic path no-ops it
+
+        st.reverb_delay_samples = delay_frames * channels;
+        st.reverb_delay = pool_calloc(st.reverb_delay_samples, sizeof(float_sample_t));
+        if (!st.reverb_delay) return 0;    // let the generic path report the failure
+        st.reverb_feedback = job->reverb.damping * 0.5f;
+        st.reverb_wet = job->reverb.wet_level;
+    }
+
+    kernel(&st, input, output, length);
+
+    pool_free(st.reverb_delay);
+    *peak_out = st.peak;
+    return 1;
+}
+
+// int16 wrappers around the float kernels: these keep the original
+// audio_buffer_t API for callers outside the fused pipeline, at the cost
+// of one conversion round trip per call.
+
+static int apply_float_effect_i16(audio_buffer_t *buffer,
+                                  int (*kernel)(float_sample_t *, size_t, uint32_t,
+                                                uint16_t, const void *),
+                                  const void *params) {
+    if (!buffer || !params || buffer->length == 0) return -1;
+
+    float_sample_t *float_samples = pool_malloc(buffer->length * sizeof(float_sample_t));
+    if (!float_samples) return -1;
+
+    samples_to_float(buffer->data, float_samples, buffer->length);
+
+    uint16_t channels = buffer->channels > 0 ? buffer->channels : 1;
+    int result = kernel(float_samples, buffer->length, buffer->sample_rate,
+                        channels, params);
+    if (result == 0) {
+        samples_from_float(float_samples, buffer->data, buffer->length);
+    }
+
+    pool_free(float_samples);
+    return result;
+}
+
+static int low_pass_kernel(float_sample_t *samples, size_t length,
+                           uint32_t sample_rate, uint16_t channels, const void *params) {
+    return effect_low_pass_f(samples, length, sample_rate, channels,
+                             (const filter_params_t *)params);
+}
+
+static int high_pass_kernel(float_sample_t *samples, size_t length,
+                            uint32_t sample_rate, uint16_t channels, const void *params) {
+    return effect_high_pass_f(samples, length, sample_rate, channels,
+                              (const filter_params_t *)params);
+}
+
+static int reverb_kernel(float_sample_t *samples, size_t length,
+                         uint32_t sample_rate, uint16_t channels, const void *params) {
+    return effect_reverb_f(samples, length, sample_rate, channels,
+                           (const reverb_params_t *)params);
+}
+
+static int echo_kernel(float_sample_t *samples, size_t length,
+                       uint32_t sample_rate, uint16_t channels, const void *params) {
+    return effect_echo_f(samples, length, sample_rate, channels,
+                         (const echo_params_t *)params);
+}
+
+static int pitch_shift_kernel(float_sample_t *samples, size_t length,
+                              uint32_t sample_rate, uint16_t channels, const void *params) {
+    (void)sample_rate;
+    return effect_pitch_shift_f(samples, length, channels, (const pitch_params_t *)params);
+}
+
+static int distortion_kernel(float_sample_t *samples, size_t length,
+                             uint32_t sample_rate, uint16_t channels, const void *params) {
+    (void)sample_rate;
+    (void)channels;
+    return effect_distortion_f(samples, length, (const distortion_params_t *)params);
+}
+
+int apply_low_pass_filter(audio_buffer_t *buffer, const filter_params_t *params) {
+    return apply_float_effect_i16(buffer, low_pass_kernel, params);
+}
+
+int apply_high_pass_filter(audio_buffer_t *buffer, const filter_params_t *params) {
+    return apply_float_effect_i16(buffer, high_pass_kernel, params);
+}
+
+int apply_reverb(audio_buffer_t *buffer, const reverb_params_t *params) {
+    return apply_float_effect_i16(buffer, reverb_kernel, params);
+}
+
+int apply_echo(audio_buffer_t *buffer, const echo_params_t *params) {
+    return apply_float_effect_i16(buffer, echo_kernel, params);
+}
+
+int apply_pitch_shift(audio_buffer_t *buffer, const pitch_params_t *params) {
+    return apply_float_effect_i16(buffer, pitch_shift_kernel, params);
+}
+
+int apply_distortion(audio_buffer_t *buffer, const distortion_params_t *params) {
+    return apply_float_effect_i16(buffer, distortion_kernel, params);
+}
+
 int normalize_audio(audio_buffer_t *buffer) {
     if (!buffer || buffer->length == 0) return -1;
-    
+
     // Find maximum absolute value
     int32_t max_val = 0;
     for (size_t i = 0; i < buffer->length; i++) {
@@ -266,18 +1021,18 @@ int normalize_audio(audio_buffer_t *buffer) {
             max_val = abs_val;
         }
     }
-    
+
     if (max_val == 0) return 0; // Silent audio
-    
+
     // Calculate scale factor (leave some headroom)
     float scale = (32767.0f * 0.95f) / (float)max_val;
-    
+
     if (scale < 1.0f) {
         // Only scale down if needed
         for (size_t i = 0; i < buffer->length; i++) {
             buffer->data[i] = clamp_sample((float)buffer->data[i] * scale);
         }
     }
-    
+
     return 0;
-}
\ No newline at end of file
+}
@@ -3,16 +3,52 @@
 #include "redis_client.h"
 #include "base64.h"
 #include "wav_writer.h"
+#include "buffer_pool.h"
+#include "fast_math.h"
+#include "job_timing.h"
+#include "json_lite.h"
 #include <json-c/json.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// In-place scan callback for the effects array: accumulates the mask
+// straight off the metadata string, no DOM
+typedef struct {
+    uint32_t mask;
+    int use_convolution;
+} effects_scan_t;
+
+static int effect_name_cb(const char *name, size_t len, void *arg) {
+    effects_scan_t *scan = arg;
+
+    if (len == 8 && memcmp(name, "low_pass", 8) == 0) {
+        scan->mask |= EFFECT_LOW_PASS;
+    } else if (len == 9 && memcmp(name, "high_pass", 9) == 0) {
+        scan->mask |= EFFECT_HIGH_PASS;
+    } else if (len == 6 && memcmp(name, "reverb", 6) == 0) {
+        scan->mask |= EFFECT_REVERB;
+    } else if (len == 10 && memcmp(name, "reverb_fft", 10) == 0) {
+        scan->mask |= EFFECT_REVERB;
+        scan->use_convolution = 1;
+    } else if (len == 4 && memcmp(name, "echo", 4) == 0) {
+        scan->mask |= EFFECT_ECHO;
+    } else if (len == 11 && memcmp(name, "pitch_shift", 11) == 0) {
+        scan->mask |= EFFECT_PITCH_SHIFT;
+    } else if (len == 10 && memcmp(name, "distortion", 10) == 0) {
+        scan->mask |= EFFECT_DISTORTION;
+    }
+    return 0;
+}
 
 static int parse_effects_from_json(const char *metadata_json, audio_job_t *job) {
     if (!metadata_json || !job) return -1;
-    
+
     // Set default effects
     job->effects_mask = EFFECT_REVERB | EFFECT_LOW_PASS;
     
@@ -26,6 +62,8 @@ static int parse_effects_from_json(const char *metadata_json, audio_job_t *job)
     job->reverb.room_size = 0.7f;
     job->reverb.damping = 0.5f;
     job->reverb.wet_level = 0.3f;
+    job->reverb.tail_seconds = 2.0f;
+    job->reverb.use_convolution = 0;
     
     job->echo.delay_ms = 300.0f;
     job->echo.decay = 0.5f;
@@ -35,11 +73,24 @@ static int parse_effects_from_json(const char *metadata_json, audio_job_t *job)
     
     job->distortion.gain = 2.5f;
     job->distortion.threshold = 0.7f;
-    
+
+    // Known-schema fast path: read the effect names straight out of the
+    // metadata string. Only shapes the scanner cannot classify (escapes,
+    // non-string elements, malformed JSON) fall through to json-c.
+    effects_scan_t scan = {0, 0};
+    int rc = json_lite_each_string(metadata_json, "effects", effect_name_cb, &scan);
+    if (rc >= 0) {
+        if (rc > 0) {
+            job->effects_mask = scan.mask;
+            job->reverb.use_convolution = scan.use_convolution;
+        }
+        return 0;
+    }
+
     // Parse JSON metadata
     json_object *root = json_tokener_parse(metadata_json);
     if (!root) return 0; // Use defaults if parsing fails
-    
+
     json_object *effects_array;
     if (json_object_object_get_ex(root, "effects", &effects_array) && 
         json_object_is_type(effects_array, json_type_array)) {
@@ -57,6 +108,10 @@ static int parse_effects_from_json(const char *metadata_json, audio_job_t *job)
                 job->effects_mask |= EFFECT_HIGH_PASS;
             } else if (strcmp(effect_name, "reverb") == 0) {
                 job->effects_mask |= EFFECT_REVERB;
+            } else if (strcmp(effect_name, "reverb_fft") == 0) {
+                // Partitioned convolution engine for long room tails
+                job->effects_mask |= EFFECT_REVERB;
+                job->reverb.use_convolution = 1;
             } else if (strcmp(effect_name, "echo") == 0) {
                 job->effects_mask |= EFFECT_ECHO;
             } else if (strcmp(effect_name, "pitch_shift") == 0) {
@@ -71,10 +126,317 @@ static int parse_effects_from_json(const char *metadata_json, audio_job_t *job)
     return 0;
 }
 
-static char* create_updated_metadata(const char *original_metadata, const char *job_id, 
-                                   double processing_time_ms) {
+// 64-bit xxHash (XXH64) for the result cache: byte-identical job payloads
+// need to collapse onto the same key at memory-bandwidth speed, and the
+// multi-megabyte inputs rule out byte-at-a-time hashes.
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static uint64_t xxh_rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint64_t xxh_read64(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t xxh_read32(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t xxh64_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = xxh_rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+static uint64_t xxh64_merge(uint64_t acc, uint64_t val) {
+    acc ^= xxh64_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static uint64_t xxh64(const void *data, size_t len, uint64_t seed) {
+    const unsigned char *p = data;
+    const unsigned char *end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = seed + XXH_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME64_1;
+        do {
+            v1 = xxh64_round(v1, xxh_read64(p));      p += 8;
+            v2 = xxh64_round(v2, xxh_read64(p));      p += 8;
+            v3 = xxh64_round(v3, xxh_read64(p));      p += 8;
+            v4 = xxh64_round(v4, xxh_read64(p));      p += 8;
+        } while (p + 32 <= end);
+        h = xxh_rotl64(v1, 1) + xxh_rotl64(v2, 7) +
+            xxh_rotl64(v3, 12) + xxh_rotl64(v4, 18);
+        h = xxh64_merge(h, v1);
+        h = xxh64_merge(h, v2);
+        h = xxh64_merge(h, v3);
+        h = xxh64_merge(h, v4);
+    } else {
+        h = seed + XXH_PRIME64_5;
+    }
+
+    h += (uint64_t)len;
+
+    while (p + 8 <= end) {
+        h ^= xxh64_round(0, xxh_read64(p));
+        h = xxh_rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h ^= xxh_read32(p) * XXH_PRIME64_1;
+        h = xxh_rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= (uint64_t)(*p) * XXH_PRIME64_5;
+        h = xxh_rotl64(h, 11) * XXH_PRIME64_1;
+        p++;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Cache key for a job: xxh64 over the transported input payload, seeded
+// with a hash of the canonical effect parameters. Identical resubmissions
+// (retries, preview-then-confirm) collapse onto one entry; raw and base64
+// transports hash differently, which is correct because their stored
+// results differ too.
+static void job_cache_key(const audio_job_t *job, uint32_t sample_rate,
+                          uint16_t channels, const char *input_data,
+                          size_t input_len, char *key, size_t key_size) {
+    char params[256];
+    int n = snprintf(params, sizeof(params),
+        "f%u,%u|m%u|lp%.6g,%d|hp%.6g,%d|rv%.6g,%.6g,%.6g,%.6g,%d|ec%.6g,%.6g,%d|ps%.6g|ds%.6g,%.6g",
+        sample_rate, channels,
+        job->effects_mask,
+        job->low_pass.cutoff_freq, job->low_pass.order,
+        job->high_pass.cutoff_freq, job->high_pass.order,
+        job->reverb.room_size, job->reverb.damping, job->reverb.wet_level,
+        job->reverb.tail_seconds, job->reverb.use_convolution,
+        job->echo.delay_ms, job->echo.decay, job->echo.num_echoes,
+        job->pitch.semitones,
+        job->distortion.gain, job->distortion.threshold);
+
+    uint64_t seed = xxh64(params, (size_t)n, 0);
+    uint64_t hash = xxh64(input_data, input_len, seed);
+    snprintf(key, key_size, "audio:cache:%016llx", (unsigned long long)hash);
+}
+
+// Transport format negotiated via job metadata: format=raw means the input
+// and result payloads are raw bytes, so both base64 passes are skipped.
+static int metadata_format_is_raw(const char *metadata_json) {
+    if (!metadata_json) return 0;
+
+    const char *value;
+    size_t len;
+    int rc = json_lite_get_string(metadata_json, "format", &value, &len);
+    if (rc >= 0) {
+        return rc == 1 && len == 3 && memcmp(value, "raw", 3) == 0;
+    }
+
+    json_object *root = json_tokener_parse(metadata_json);
+    if (!root) return 0;
+
+    int raw = 0;
+    json_object *format_obj;
+    if (json_object_object_get_ex(root, "format", &format_obj)) {
+        const char *format = json_object_get_string(format_obj);
+        if (format && strcmp(format, "raw") == 0) {
+            raw = 1;
+        }
+    }
+
+    json_object_put(root);
+    return raw;
+}
+
+// Fetch an optional string field from the job metadata
+static char* metadata_get_string(const char *metadata_json, const char *key) {
+    if (!metadata_json) return NULL;
+
+    const char *range;
+    size_t len;
+    int rc = json_lite_get_string(metadata_json, key, &range, &len);
+    if (rc == 0) return NULL;
+    if (rc == 1) return strndup(range, len);
+
+    json_object *root = json_tokener_parse(metadata_json);
+    if (!root) return NULL;
+
+    char *value = NULL;
+    json_object *obj;
+    if (json_object_object_get_ex(root, key, &obj)) {
+        const char *str = json_object_get_string(obj);
+        if (str) value = strdup(str);
+    }
+
+    json_object_put(root);
+    return value;
+}
+
+// Fetch an optional integer field from the job metadata
+static int metadata_get_int(const char *metadata_json, const char *key, int fallback) {
+    if (!metadata_json) return fallback;
+
+    int scanned;
+    int rc = json_lite_get_int(metadata_json, key, &scanned);
+    if (rc == 1) return scanned;
+    if (rc == 0) return fallback;
+
+    json_object *root = json_tokener_parse(metadata_json);
+    if (!root) return fallback;
+
+    int value = fallback;
+    json_object *obj;
+    if (json_object_object_get_ex(root, key, &obj) &&
+        json_object_is_type(obj, json_type_int)) {
+        value = json_object_get_int(obj);
+    }
+
+    json_object_put(root);
+    return value;
+}
+
+// Map a shared-volume input read-only; the pipeline then reads PCM
+// straight from the page cache without copying it into worker memory
+static int map_input_file(const char *path, void **data_out, size_t *len_out) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "Failed to open input file: %s\n", path);
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return -1;
+    }
+
+    void *mapped = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "Failed to map input file: %s\n", path);
+        return -1;
+    }
+
+    *data_out = mapped;
+    *len_out = (size_t)st.st_size;
+    return 0;
+}
+
+// Write the result under a temporary name and rename it into place, so
+// producers polling the path never observe a partial file
+static int write_file_atomic(const char *path, const void *data, size_t len) {
+    char tmp_path[4096 + 8];  // room for the longest path plus ".tmp"
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        fprintf(stderr, "Failed to create result file: %s\n", tmp_path);
+        return -1;
+    }
+
+    const unsigned char *p = data;
+    size_t remaining = len;
+    while (remaining > 0) {
+        ssize_t n = write(fd, p, remaining);
+        if (n < 0) {
+            close(fd);
+            unlink(tmp_path);
+            return -1;
+        }
+        p += n;
+        remaining -= (size_t)n;
+    }
+
+    if (close(fd) != 0 || rename(tmp_path, path) != 0) {
+        unlink(tmp_path);
+        return -1;
+    }
+
+    return 0;
+}
+
+static char* create_updated_metadata(const char *original_metadata, const char *job_id,
+                                   const job_timing_t *timing, int from_cache,
+                                   const char *result_path) {
     json_object *root;
-    
+
+    // Append-style fast path: copy the original object minus its closing
+    // brace into a stack buffer and serialize the processing fields onto
+    // the end - no DOM, no allocations beyond the final strdup. Falls
+    // back to json-c when the original does not scan as one clean object,
+    // is too large, or already carries a processed_at (a reclaimed retry;
+    // appending would duplicate keys where json-c replaces them).
+    {
+        time_t now = time(NULL);
+        struct tm *utc_tm = gmtime(&now);
+        char iso_time[32];
+        strftime(iso_time, sizeof(iso_time), "%Y-%m-%dT%H:%M:%S", utc_tm);
+
+        char buf[8192];
+        const char *original = original_metadata ? original_metadata : "{}";
+        size_t end;
+        int has_members;
+        if (json_lite_object_end(original, &end, &has_members) == 0 &&
+            json_lite_has_key(original, "processed_at") == 0) {
+            json_writer_t w;
+            json_writer_init(&w, buf, sizeof(buf));
+            json_writer_raw(&w, original, end);
+            w.need_comma = has_members;
+
+            json_writer_member_string(&w, "processed_at", iso_time);
+
+            if (timing) {
+                json_writer_member_double(&w, "processing_time_ms", timing->total_ms);
+                json_writer_open_object(&w, "timings_ms");
+                for (int stage = 0; stage < STAGE_COUNT; stage++) {
+                    if (timing->stage_ms[stage] > 0.0) {
+                        json_writer_member_double(&w,
+                            timing_stage_name((timing_stage_t)stage),
+                            timing->stage_ms[stage]);
+                    }
+                }
+                json_writer_close_object(&w);
+            }
+
+            if (from_cache) {
+                json_writer_member_string(&w, "result_cache", "hit");
+            }
+            if (result_path) {
+                json_writer_member_string(&w, "result_path", result_path);
+            }
+
+            char hostname[256];
+            if (gethostname(hostname, sizeof(hostname)) == 0) {
+                json_writer_member_string(&w, "hostname", hostname);
+            }
+
+            json_writer_raw(&w, "}", 1);
+            if (json_writer_ok(&w)) {
+                return strdup(buf);
+            }
+        }
+    }
+
     // Parse original metadata or create new object
     if (original_metadata) {
         root = json_tokener_parse(original_metadata);
@@ -92,8 +454,33 @@ static char* create_updated_metadata(const char *original_metadata, const char *
     strftime(iso_time, sizeof(iso_time), "%Y-%m-%dT%H:%M:%S", utc_tm);
     
     json_object_object_add(root, "processed_at", json_object_new_string(iso_time));
-    json_object_object_add(root, "processing_time_ms", json_object_new_int((int)processing_time_ms));
-    
+
+    // Wall-clock stage breakdown (CLOCK_MONOTONIC); processing_time_ms was
+    // previously CPU time from clock(), which hid all the Redis waits
+    if (timing) {
+        json_object_object_add(root, "processing_time_ms",
+                               json_object_new_double(timing->total_ms));
+
+        json_object *timings = json_object_new_object();
+        for (int stage = 0; stage < STAGE_COUNT; stage++) {
+            if (timing->stage_ms[stage] > 0.0) {
+                json_object_object_add(timings, timing_stage_name((timing_stage_t)stage),
+                                       json_object_new_double(timing->stage_ms[stage]));
+            }
+        }
+        json_object_object_add(root, "timings_ms", timings);
+    }
+
+    // Flag deduplicated jobs so producers can verify the cache hit rate
+    if (from_cache) {
+        json_object_object_add(root, "result_cache", json_object_new_string("hit"));
+    }
+
+    // Path-transport jobs: tell the producer where the WAV landed
+    if (result_path) {
+        json_object_object_add(root, "result_path", json_object_new_string(result_path));
+    }
+
     // Get hostname
     char hostname[256];
     if (gethostname(hostname, sizeof(hostname)) == 0) {
@@ -108,229 +495,792 @@ static char* create_updated_metadata(const char *original_metadata, const char *
     return result;
 }
 
+// Generic float-domain chain plus quantization: runs every enabled effect
+// over the float working buffer in place, then folds the normalization
+// gain into the int16 conversion writing pcm_out. Shared between the
+// int16 entry below and the fused base64 ingest in process_job_batch.
+static int float_chain_to_pcm(audio_job_t *job, float_sample_t *samples,
+                              size_t length, uint32_t sample_rate,
+                              uint16_t channels, sample_t *pcm_out) {
+    int result = 0;
+    double t0;
+
+    if (result == 0 && (job->effects_mask & EFFECT_LOW_PASS)) {
+        t0 = timing_now_ms();
+        result = effect_low_pass_f(samples, length, sample_rate,
+                                   channels, &job->low_pass);
+        job_timing_add(job->timing, STAGE_LOW_PASS, timing_now_ms() - t0);
+    }
+
+    if (result == 0 && (job->effects_mask & EFFECT_HIGH_PASS)) {
+        t0 = timing_now_ms();
+        result = effect_high_pass_f(samples, length, sample_rate,
+                                    channels, &job->high_pass);
+        job_timing_add(job->timing, STAGE_HIGH_PASS, timing_now_ms() - t0);
+    }
+
+    if (result == 0 && (job->effects_mask & EFFECT_REVERB)) {
+        t0 = timing_now_ms();
+        result = effect_reverb_f(samples, length, sample_rate,
+                                 channels, &job->reverb);
+        job_timing_add(job->timing, STAGE_REVERB, timing_now_ms() - t0);
+    }
+
+    if (result == 0 && (job->effects_mask & EFFECT_ECHO)) {
+        t0 = timing_now_ms();
+        result = effect_echo_f(samples, length, sample_rate,
+                               channels, &job->echo);
+        job_timing_add(job->timing, STAGE_ECHO, timing_now_ms() - t0);
+    }
+
+    if (result == 0 && (job->effects_mask & EFFECT_PITCH_SHIFT)) {
+        t0 = timing_now_ms();
+        result = effect_pitch_shift_f(samples, length, channels, &job->pitch);
+        job_timing_add(job->timing, STAGE_PITCH_SHIFT, timing_now_ms() - t0);
+    }
+
+    if (result == 0 && (job->effects_mask & EFFECT_DISTORTION)) {
+        t0 = timing_now_ms();
+        result = effect_distortion_f(samples, length, &job->distortion);
+        job_timing_add(job->timing, STAGE_DISTORTION, timing_now_ms() - t0);
+    }
+
+    if (result == 0) {
+        // Normalization folds into the output conversion: one read-only
+        // peak reduction, then the gain rides along with the int16
+        // quantization scale - two sweeps instead of the old peak/scale/
+        // convert three
+        t0 = timing_now_ms();
+        float peak = audio_peak_f(samples, length);
+        float gain = peak > 0.95f ? 0.95f / peak : 1.0f;
+        job_timing_add(job->timing, STAGE_NORMALIZE, timing_now_ms() - t0);
+        samples_from_float_scaled(samples, pcm_out, length, gain);
+    }
+
+    return result;
+}
+
 int process_audio_job(audio_job_t *job) {
     if (!job || !job->input_buffer || !job->output_buffer) return -1;
-    
-    // Copy input to output buffer
-    if (audio_buffer_copy(job->input_buffer, job->output_buffer) != 0) {
+
+    audio_buffer_t *input = job->input_buffer;
+    audio_buffer_t *output = job->output_buffer;
+
+    // Callers may pass a fixed view into a WAV image as the output; such
+    // views arrive pre-sized, so the resize only fires for owned buffers
+    if (output->capacity < input->length &&
+        audio_buffer_resize(output, input->length) != 0) {
         return -1;
     }
-    
-    // Apply effects based on mask
-    if (job->effects_mask & EFFECT_LOW_PASS) {
-        if (apply_low_pass_filter(job->output_buffer, &job->low_pass) != 0) {
-            return -1;
+
+    uint16_t channels = input->channels > 0 ? input->channels : 1;
+
+    // Hot chains take the specialized single-loop kernel: int16 in,
+    // effects and peak in registers, int16 out, one memory crossing.
+    // Normalization is deferred to an in-place scale like the streaming
+    // path's, which only fires for clipping-range peaks.
+    double t0 = timing_now_ms();
+    float fused_peak = 0.0f;
+    if (audio_fused_process(job, input->data, output->data, input->length,
+                            input->sample_rate, channels, &fused_peak)) {
+        job_timing_add(job->timing, STAGE_EFFECTS_FUSED, timing_now_ms() - t0);
+
+        if (fused_peak > 0.95f) {
+            t0 = timing_now_ms();
+            float scale = 0.95f / fused_peak;
+            for (size_t i = 0; i < input->length; i++) {
+                output->data[i] = fm_clamp_s16((float)output->data[i] * scale);
+            }
+            job_timing_add(job->timing, STAGE_NORMALIZE, timing_now_ms() - t0);
         }
+
+        output->length = input->length;
+        output->sample_rate = input->sample_rate;
+        output->channels = input->channels;
+        return 0;
     }
-    
-    if (job->effects_mask & EFFECT_HIGH_PASS) {
-        if (apply_high_pass_filter(job->output_buffer, &job->high_pass) != 0) {
-            return -1;
+
+    // Fused pipeline: convert to float once, chain all enabled effects on
+    // the same float buffer, and convert back once at the end. This halves
+    // memory traffic versus per-effect int16<->float round trips and avoids
+    // repeated requantization between stages.
+    float_sample_t *samples = pool_malloc(input->length * sizeof(float_sample_t));
+    if (!samples) return -1;
+
+    samples_to_float(input->data, samples, input->length);
+
+    int result = float_chain_to_pcm(job, samples, input->length,
+                                    input->sample_rate, channels,
+                                    output->data);
+    if (result == 0) {
+        output->length = input->length;
+        output->sample_rate = input->sample_rate;
+        output->channels = input->channels;
+    }
+
+    pool_free(samples);
+    return result;
+}
+
+// Chunked pipeline block sizing: 256K samples keeps the per-block float
+// scratch at 1MB; clips below the threshold stay on the simpler batch path.
+#define STREAM_BLOCK_SAMPLES (256 * 1024)
+#define STREAM_MIN_SAMPLES   (1024 * 1024)
+
+// Base64 chars consumed per streaming chunk (multiple of 4; decodes to at
+// most STREAM_BLOCK_SAMPLES * 2 bytes of PCM)
+#define STREAM_CHUNK_CHARS   ((STREAM_BLOCK_SAMPLES * 2 / 3) * 4)
+
+// Process a large clip in bounded blocks: decode (if base64), convert to
+// float, run the stateful effect chain, and convert int16 straight into
+// the WAV image. Normalization is deferred: the running peak from the
+// stream state drives one in-place scaling pass over the finished PCM.
+static int process_job_streaming(const audio_job_t *job,
+                                 const char *input_data, size_t input_len,
+                                 int raw_format, uint32_t sample_rate,
+                                 uint16_t channels,
+                                 uint8_t **wav_data_out, size_t *wav_size_out) {
+    size_t total_samples = (raw_format ? input_len
+                            : base64_decoded_size_len(input_data, input_len)) / sizeof(sample_t);
+    size_t total_frames = total_samples / channels;
+    if (total_frames == 0) return -1;
+    total_samples = total_frames * (size_t)channels;  // drop a trailing partial frame
+
+    size_t pcm_size = total_samples * sizeof(sample_t);
+    size_t wav_size = wav_header_size() + pcm_size;
+    uint8_t *wav_data = pool_malloc(wav_size);
+    if (!wav_data) return -1;
+    wav_write_header(wav_data, total_frames, sample_rate, channels);
+    sample_t *pcm_out = (sample_t *)(wav_data + wav_header_size());
+
+    // Block boundaries must land on frame boundaries for the per-channel
+    // effect state, so the block size is trimmed to a frame multiple
+    size_t block_samples = STREAM_BLOCK_SAMPLES - STREAM_BLOCK_SAMPLES % channels;
+
+    audio_stream_state_t *state = audio_stream_state_create(job, sample_rate, channels);
+    float_sample_t *block = pool_malloc((STREAM_BLOCK_SAMPLES + AUDIO_MAX_CHANNELS + 1)
+                                        * sizeof(float_sample_t));
+    // Base64 staging: decoded chunk bytes plus carried leftovers - an odd
+    // byte (3-byte base64 quanta vs 2-byte samples) and up to a frame's
+    // worth of samples held back for alignment
+    unsigned char *stage = raw_format ? NULL
+                         : pool_malloc(STREAM_CHUNK_CHARS / 4 * 3
+                                       + 2 * (AUDIO_MAX_CHANNELS + 1));
+
+    if (!state || !block || (!raw_format && !stage)) {
+        audio_stream_state_destroy(state);
+        pool_free(block);
+        pool_free(stage);
+        pool_free(wav_data);
+        return -1;
+    }
+
+    size_t out_pos = 0;   // samples written
+    int rc = 0;
+
+    double t0;
+
+    if (raw_format) {
+        const sample_t *pcm_in = (const sample_t *)input_data;
+        while (out_pos < total_samples && rc == 0) {
+            size_t n = total_samples - out_pos;
+            if (n > block_samples) n = block_samples;
+
+            t0 = timing_now_ms();
+            samples_to_float(pcm_in + out_pos, block, n);
+            job_timing_add(job->timing, STAGE_DECODE, timing_now_ms() - t0);
+
+            t0 = timing_now_ms();
+            rc = audio_stream_process_block(state, block, n);
+            job_timing_add(job->timing, STAGE_EFFECTS_FUSED, timing_now_ms() - t0);
+            if (rc == 0) {
+                t0 = timing_now_ms();
+                samples_from_float(block, pcm_out + out_pos, n);
+                job_timing_add(job->timing, STAGE_WAV_BUILD, timing_now_ms() - t0);
+                out_pos += n;
+            }
+        }
+    } else {
+        size_t in_pos = 0;    // base64 chars consumed
+        size_t carry = 0;     // leftover odd byte from the previous chunk
+        while (in_pos < input_len && rc == 0) {
+            size_t chunk = input_len - in_pos;
+            if (chunk > STREAM_CHUNK_CHARS) chunk = STREAM_CHUNK_CHARS;
+
+            size_t chunk_bytes = 0;
+            t0 = timing_now_ms();
+            if (base64_decode_len(input_data + in_pos, chunk, stage + carry, &chunk_bytes) != 0) {
+                rc = -1;
+                break;
+            }
+            in_pos += chunk;
+            chunk_bytes += carry;
+
+            size_t n = chunk_bytes / sizeof(sample_t);
+            n -= n % channels;   // whole frames only; the rest carries over
+            if (out_pos + n > total_samples) n = total_samples - out_pos;
+
+            if (n > 0) {
+                samples_to_float((const sample_t *)stage, block, n);
+                job_timing_add(job->timing, STAGE_DECODE, timing_now_ms() - t0);
+
+                t0 = timing_now_ms();
+                rc = audio_stream_process_block(state, block, n);
+                job_timing_add(job->timing, STAGE_EFFECTS_FUSED, timing_now_ms() - t0);
+                if (rc != 0) break;
+
+                t0 = timing_now_ms();
+                samples_from_float(block, pcm_out + out_pos, n);
+                job_timing_add(job->timing, STAGE_WAV_BUILD, timing_now_ms() - t0);
+                out_pos += n;
+            } else {
+                job_timing_add(job->timing, STAGE_DECODE, timing_now_ms() - t0);
+            }
+
+            carry = chunk_bytes - n * sizeof(sample_t);
+            if (carry) {
+                memmove(stage, stage + n * sizeof(sample_t), carry);
+            }
         }
+        if (rc == 0 && out_pos != total_samples) rc = -1;
     }
-    
-    if (job->effects_mask & EFFECT_REVERB) {
-        if (apply_reverb(job->output_buffer, &job->reverb) != 0) {
-            return -1;
+
+    // Deferred normalization: one in-place pass over the finished PCM
+    if (rc == 0) {
+        float peak = audio_stream_peak(state);
+        if (peak > 0.95f) {
+            t0 = timing_now_ms();
+            float scale = 0.95f / peak;
+            for (size_t i = 0; i < total_samples; i++) {
+                pcm_out[i] = fm_clamp_s16((float)pcm_out[i] * scale);
+            }
+            job_timing_add(job->timing, STAGE_NORMALIZE, timing_now_ms() - t0);
         }
     }
-    
-    if (job->effects_mask & EFFECT_ECHO) {
-        if (apply_echo(job->output_buffer, &job->echo) != 0) {
+
+    audio_stream_state_destroy(state);
+    pool_free(block);
+    pool_free(stage);
+
+    if (rc != 0) {
+        pool_free(wav_data);
+        return -1;
+    }
+
+    *wav_data_out = wav_data;
+    *wav_size_out = wav_size;
+    return 0;
+}
+
+// Batch path: decode and process the whole clip in one piece
+static int process_job_batch(audio_job_t *job,
+                             const char *input_data, size_t input_len,
+                             int raw_format, uint32_t sample_rate,
+                             uint16_t channels,
+                             uint8_t **wav_data_out, size_t *wav_size_out) {
+    // Fused base64 ingest: when the generic float chain is going to run
+    // anyway (no specialized int16 kernel matched the mask), decode
+    // straight into the float working buffer, skipping both the
+    // clip-sized PCM staging buffer and the separate int16-to-float
+    // sweep. Hot-mask jobs keep the plain decode below; their fused
+    // int16 kernel reads the decoded bytes directly.
+    if (!raw_format && !audio_fused_supported(job)) {
+        size_t max_samples = base64_decoded_size_len(input_data, input_len)
+                             / sizeof(sample_t);
+        if (max_samples == 0) return -1;
+
+        float_sample_t *samples = pool_malloc(max_samples * sizeof(float_sample_t));
+        if (!samples) {
+            fprintf(stderr, "Failed to allocate memory for decoded data\n");
             return -1;
         }
-    }
-    
-    if (job->effects_mask & EFFECT_PITCH_SHIFT) {
-        if (apply_pitch_shift(job->output_buffer, &job->pitch) != 0) {
+
+        double t0 = timing_now_ms();
+        size_t sample_count = 0;
+        if (base64_decode_to_float(input_data, input_len,
+                                   samples, &sample_count) != 0) {
+            fprintf(stderr, "Failed to decode base64 input data\n");
+            pool_free(samples);
+            return -1;
+        }
+        job_timing_add(job->timing, STAGE_DECODE, timing_now_ms() - t0);
+
+        size_t frame_count = sample_count / channels;
+        if (frame_count == 0) {
+            pool_free(samples);
             return -1;
         }
+        sample_count = frame_count * (size_t)channels;  // drop a trailing partial frame
+
+        t0 = timing_now_ms();
+        uint8_t *wav_data = NULL;
+        size_t wav_size = 0;
+        sample_t *pcm_out = NULL;
+        if (wav_image_create(frame_count, sample_rate, channels,
+                             &wav_data, &wav_size, &pcm_out) != 0) {
+            fprintf(stderr, "Failed to allocate WAV image\n");
+            pool_free(samples);
+            return -1;
+        }
+        job_timing_add(job->timing, STAGE_WAV_BUILD, timing_now_ms() - t0);
+
+        int result = float_chain_to_pcm(job, samples, sample_count,
+                                        sample_rate, channels, pcm_out);
+        pool_free(samples);
+        if (result != 0) {
+            pool_free(wav_data);
+            return result;
+        }
+
+        *wav_data_out = wav_data;
+        *wav_size_out = wav_size;
+        return 0;
     }
-    
-    if (job->effects_mask & EFFECT_DISTORTION) {
-        if (apply_distortion(job->output_buffer, &job->distortion) != 0) {
+
+    // Get PCM bytes: format=raw jobs carry them directly, legacy jobs
+    // carry base64 text that needs a decode pass
+    size_t decoded_len;
+    const unsigned char *decoded_data;
+    unsigned char *decode_buf = NULL;
+    if (raw_format) {
+        decoded_data = (const unsigned char*)input_data;
+        decoded_len = input_len;
+    } else {
+        size_t max_decoded_len = base64_decoded_size_len(input_data, input_len);
+        decode_buf = pool_malloc(max_decoded_len);
+        if (!decode_buf) {
+            fprintf(stderr, "Failed to allocate memory for decoded data\n");
             return -1;
         }
+
+        double t0 = timing_now_ms();
+        if (base64_decode_len(input_data, input_len, decode_buf, &decoded_len) != 0) {
+            fprintf(stderr, "Failed to decode base64 input data\n");
+            pool_free(decode_buf);
+            return -1;
+        }
+        job_timing_add(job->timing, STAGE_DECODE, timing_now_ms() - t0);
+        decoded_data = decode_buf;
     }
-    
-    // Always normalize at the end
-    normalize_audio(job->output_buffer);
-    
-    return 0;
-}
 
-int process_redis_job(redis_client_t *redis_client, const char *job_id) {
-    if (!redis_client || !job_id) return -1;
-    
-    printf("Processing job: %s\n", job_id);
-    
-    clock_t start_time = clock();
-    
-    // Update status to processing
-    if (redis_update_job_status(redis_client, job_id, "processing") != 0) {
-        fprintf(stderr, "Failed to update job status to processing\n");
+    size_t sample_count = decoded_len / sizeof(sample_t);
+    size_t frame_count = sample_count / channels;
+    if (frame_count == 0) {
+        pool_free(decode_buf);
         return -1;
     }
-    
-    // Get input data
-    char *input_data_b64 = NULL;
-    if (redis_get_job_input(redis_client, job_id, &input_data_b64) != 0 || !input_data_b64) {
-        fprintf(stderr, "Failed to get job input data\n");
-        redis_store_job_error(redis_client, job_id, "Input data not found");
-        redis_update_job_status(redis_client, job_id, "failed");
+    sample_count = frame_count * (size_t)channels;  // drop a trailing partial frame
+
+    // Allocate the WAV image up front so the fused pipeline writes its
+    // final int16 conversion straight into the framed PCM area. Stack
+    // views over the decoded bytes and the image replace the owned
+    // input/output buffers, dropping both clip-sized staging copies the
+    // old copy-in/create_wav_file path made.
+    double t0 = timing_now_ms();
+    uint8_t *wav_data = NULL;
+    size_t wav_size = 0;
+    sample_t *pcm_out = NULL;
+    if (wav_image_create(frame_count, sample_rate, channels,
+                         &wav_data, &wav_size, &pcm_out) != 0) {
+        fprintf(stderr, "Failed to allocate WAV image\n");
+        pool_free(decode_buf);
         return -1;
     }
-    
-    // Get metadata
-    char *metadata_json = NULL;
-    redis_get_job_metadata(redis_client, job_id, &metadata_json);
-    
-    // Decode base64 input data
-    size_t decoded_len;
-    size_t max_decoded_len = base64_decoded_size(input_data_b64);
-    unsigned char *decoded_data = malloc(max_decoded_len);
-    if (!decoded_data) {
-        fprintf(stderr, "Failed to allocate memory for decoded data\n");
-        free(input_data_b64);
-        free(metadata_json);
-        redis_store_job_error(redis_client, job_id, "Memory allocation failed");
-        redis_update_job_status(redis_client, job_id, "failed");
-        return -1;
+    job_timing_add(job->timing, STAGE_WAV_BUILD, timing_now_ms() - t0);
+
+    audio_buffer_t input_view = {0};
+    input_view.data = (sample_t*)(uintptr_t)decoded_data;  // read-only in the pipeline
+    input_view.length = sample_count;
+    input_view.capacity = sample_count;
+    input_view.sample_rate = sample_rate;
+    input_view.channels = channels;
+
+    audio_buffer_t output_view = {0};
+    output_view.data = pcm_out;
+    output_view.capacity = sample_count;
+    output_view.sample_rate = sample_rate;
+    output_view.channels = channels;
+
+    job->input_buffer = &input_view;
+    job->output_buffer = &output_view;
+
+    int result = process_audio_job(job);
+
+    job->input_buffer = NULL;
+    job->output_buffer = NULL;
+    pool_free(decode_buf);
+
+    if (result != 0) {
+        pool_free(wav_data);
+        return result;
     }
-    
-    if (base64_decode(input_data_b64, decoded_data, &decoded_len) != 0) {
-        fprintf(stderr, "Failed to decode base64 input data\n");
-        free(input_data_b64);
+
+    *wav_data_out = wav_data;
+    *wav_size_out = wav_size;
+    return 0;
+}
+
+// Publish the per-job telemetry record (queue wait, stage breakdown,
+// payload size, outcome) to the capped audio:telemetry stream - the
+// backlog-latency signal the autoscaler watches instead of CPU.
+// Best-effort: a telemetry failure never affects the job outcome.
+static void publish_job_telemetry(redis_client_t *redis_client, const char *job_id,
+                                  const char *metadata_json,
+                                  const job_timing_t *timing,
+                                  size_t payload_bytes, int success) {
+    if (!redis_telemetry_enabled()) return;
+
+    // Queue wait from the producer's enqueue stamp (epoch milliseconds,
+    // metadata field enqueued_at): dequeue time is now minus the
+    // processing wall time. Jobs without the stamp omit the field.
+    double queue_wait_ms = -1.0;
+    double enqueued_at = 0.0;
+    if (metadata_json &&
+        json_lite_get_number(metadata_json, "enqueued_at", &enqueued_at) == 1 &&
+        enqueued_at > 0.0) {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        double wall_ms = (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+        queue_wait_ms = wall_ms - enqueued_at - timing->total_ms;
+        if (queue_wait_ms < 0.0) queue_wait_ms = 0.0;  // clock skew
+    }
+
+    // Stage breakdown as one compact JSON field, only stages that ran
+    char stages[512];
+    json_writer_t w;
+    json_writer_init(&w, stages, sizeof(stages));
+    json_writer_raw(&w, "{", 1);
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        if (timing->stage_ms[stage] > 0.0) {
+            json_writer_member_double(&w, timing_stage_name((timing_stage_t)stage),
+                                      timing->stage_ms[stage]);
+        }
+    }
+    json_writer_raw(&w, "}", 1);
+
+    char hostname[256];
+    if (gethostname(hostname, sizeof(hostname)) != 0) hostname[0] = '\0';
+
+    redis_telemetry_job(redis_client, job_id,
+                        hostname[0] ? hostname : NULL, queue_wait_ms,
+                        timing->total_ms, payload_bytes,
+                        json_writer_ok(&w) ? stages : NULL, success);
+}
+
+// Chunked result upload sizing: inline results at or above the threshold
+// are encoded and shipped with redis_result_append in bounded pieces
+// instead of one result-sized SET. The raw chunk is a multiple of 3 so
+// every base64 chunk but the last encodes without padding and the
+// concatenation equals the whole-buffer encoding.
+#define RESULT_STREAM_MIN (1024 * 1024)
+#define RESULT_CHUNK_RAW  (384 * 1024)
+
+// Process a job whose input and metadata have already been fetched (by
+// this thread or by a prefetch stage). Takes ownership of input_data and
+// metadata_json; fetch_ms is the already-spent fetch time for the stage
+// accounting. input_data may be NULL for path-transport jobs whose
+// metadata references a shared-volume file instead of inline bytes.
+int process_fetched_job(redis_client_t *redis_client, const char *job_id,
+                        char *input_data, size_t input_len, char *metadata_json,
+                        double fetch_ms) {
+    if (!redis_client || !job_id) {
+        free(input_data);
         free(metadata_json);
-        free(decoded_data);
-        redis_store_job_error(redis_client, job_id, "Failed to decode input data");
-        redis_update_job_status(redis_client, job_id, "failed");
         return -1;
     }
-    
-    // Create audio buffers
-    size_t sample_count = decoded_len / sizeof(sample_t);
-    audio_buffer_t *input_buffer = audio_buffer_create(sample_count, 44100, 1);
-    audio_buffer_t *output_buffer = audio_buffer_create(sample_count, 44100, 1);
-    
-    if (!input_buffer || !output_buffer) {
-        fprintf(stderr, "Failed to create audio buffers\n");
-        audio_buffer_destroy(input_buffer);
-        audio_buffer_destroy(output_buffer);
-        free(input_data_b64);
+
+    printf("Processing job: %s\n", job_id);
+
+    job_timing_t timing;
+    job_timing_reset(&timing);
+    double start_ms = timing_now_ms() - fetch_ms;
+    job_timing_add(&timing, STAGE_REDIS_FETCH, fetch_ms);
+
+    int raw_format = metadata_format_is_raw(metadata_json);
+
+    // Shared-volume transport: the metadata carries file paths and the
+    // payload bytes never touch Redis. The input is mapped read-only and
+    // processed straight out of the page cache; file payloads are always
+    // raw PCM (the base64 detour exists only for inline Redis values).
+    char *input_path = metadata_get_string(metadata_json, "input_path");
+    char *result_path = metadata_get_string(metadata_json, "result_path");
+
+    const char *payload = input_data;
+    size_t payload_len = input_len;
+    void *mapped = NULL;
+    size_t mapped_len = 0;
+
+    if (input_path) {
+        if (map_input_file(input_path, &mapped, &mapped_len) != 0) {
+            redis_fail_job(redis_client, job_id, "Input file not found");
+            free(input_path);
+            free(result_path);
+            free(input_data);
+            free(metadata_json);
+            return -1;
+        }
+        payload = mapped;
+        payload_len = mapped_len;
+        raw_format = 1;
+    } else if (!input_data) {
+        fprintf(stderr, "Job %s has neither inline input nor input_path\n", job_id);
+        redis_fail_job(redis_client, job_id, "Input data not found");
+        free(result_path);
         free(metadata_json);
-        free(decoded_data);
-        redis_store_job_error(redis_client, job_id, "Failed to create audio buffers");
-        redis_update_job_status(redis_client, job_id, "failed");
         return -1;
     }
-    
-    // Copy decoded data to input buffer
-    memcpy(input_buffer->data, decoded_data, decoded_len);
-    input_buffer->length = sample_count;
-    
+
     // Create and configure job
     audio_job_t job = {0};
     job.job_id = (char*)job_id;
-    job.input_buffer = input_buffer;
-    job.output_buffer = output_buffer;
-    
+    job.timing = &timing;
+
     // Parse effects from metadata
     parse_effects_from_json(metadata_json, &job);
-    
-    // Process the job
-    int result = process_audio_job(&job);
-    
-    if (result == 0) {
-        // Create WAV file from processed PCM data
-        uint8_t *wav_data = NULL;
-        size_t wav_size = 0;
-        
-        // Convert float samples back to 16-bit PCM for WAV
-        int16_t *pcm_samples = malloc(output_buffer->length * sizeof(int16_t));
-        if (!pcm_samples) {
-            fprintf(stderr, "Failed to allocate PCM sample buffer\n");
-            audio_buffer_destroy(input_buffer);
-            audio_buffer_destroy(output_buffer);
-            free(input_data_b64);
+
+    // Clip format from metadata; absent fields keep the historical
+    // mono/44.1kHz defaults so existing producers are unaffected
+    uint32_t sample_rate = (uint32_t)metadata_get_int(metadata_json, "sample_rate", 44100);
+    int channels_field = metadata_get_int(metadata_json, "channels", 1);
+    if (sample_rate == 0 || channels_field < 1 || channels_field > AUDIO_MAX_CHANNELS) {
+        fprintf(stderr, "Job %s declares unsupported format (%d ch @ %u Hz)\n",
+                job_id, channels_field, sample_rate);
+        redis_fail_job(redis_client, job_id, "Unsupported channel count or sample rate");
+        if (mapped) munmap(mapped, mapped_len);
+        free(input_path);
+        free(result_path);
+        free(input_data);
+        free(metadata_json);
+        return -1;
+    }
+    uint16_t channels = (uint16_t)channels_field;
+
+    // Result cache lookup: an identical payload with an identical effect
+    // chain was already rendered recently, so complete the job with two
+    // cheap round trips instead of the whole decode/effects/encode path.
+    // Path-transport results live on the volume, not in Redis, so they
+    // are not cacheable this way.
+    int cacheable = (input_path == NULL);
+    char cache_key[32] = {0};
+    if (cacheable) {
+        job_cache_key(&job, sample_rate, channels, payload, payload_len,
+                      cache_key, sizeof(cache_key));
+
+        timing.total_ms = timing_now_ms() - start_ms;
+        char *hit_metadata = create_updated_metadata(metadata_json, job_id, &timing, 1, NULL);
+        double cache_t0 = timing_now_ms();
+        int cached = redis_cache_complete_job(redis_client, job_id, cache_key, hit_metadata);
+        free(hit_metadata);
+
+        if (cached > 0) {
+            job_timing_add(&timing, STAGE_REDIS_STORE, timing_now_ms() - cache_t0);
+            timing.total_ms = timing_now_ms() - start_ms;
+            timing_record_job(&timing);
+            printf("Job %s completed from result cache in %.2f ms\n", job_id, timing.total_ms);
+            publish_job_telemetry(redis_client, job_id, metadata_json,
+                                  &timing, payload_len, 1);
+            free(result_path);
+            free(input_data);
             free(metadata_json);
-            free(decoded_data);
-            redis_store_job_error(redis_client, job_id, "Memory allocation failed");
-            redis_update_job_status(redis_client, job_id, "failed");
-            return -1;
+            return 0;
         }
-        
-        // Convert float samples to 16-bit PCM
-        for (size_t i = 0; i < output_buffer->length; i++) {
-            float sample = output_buffer->data[i];
-            // Clamp to [-1.0, 1.0] and convert to 16-bit
-            if (sample > 1.0f) sample = 1.0f;
-            if (sample < -1.0f) sample = -1.0f;
-            pcm_samples[i] = (int16_t)(sample * 32767.0f);
+    }
+
+    size_t expected_samples = (raw_format ? payload_len
+                               : base64_decoded_size_len(payload, payload_len)) / sizeof(sample_t);
+
+    uint8_t *wav_data = NULL;
+    size_t wav_size = 0;
+    int result;
+
+    // Long clips with a streamable effect chain go through the chunked
+    // pipeline: O(block) scratch instead of several clip-sized buffers
+    if (expected_samples >= STREAM_MIN_SAMPLES && audio_stream_supported(job.effects_mask)) {
+        result = process_job_streaming(&job, payload, payload_len, raw_format,
+                                       sample_rate, channels, &wav_data, &wav_size);
+    } else {
+        result = process_job_batch(&job, payload, payload_len, raw_format,
+                                   sample_rate, channels, &wav_data, &wav_size);
+    }
+
+    if (result == 0 && input_path) {
+        // The WAV goes back to the shared volume; Redis carries only the
+        // result path, metadata and status. Producers that did not pick a
+        // result_path get one derived from the input path.
+        char derived_path[4096];
+        if (!result_path) {
+            snprintf(derived_path, sizeof(derived_path), "%s.out.wav", input_path);
         }
-        
-        // Create WAV file
-        if (create_wav_file(pcm_samples, output_buffer->length, 44100, 1, &wav_data, &wav_size) != 0) {
-            fprintf(stderr, "Failed to create WAV file\n");
-            free(pcm_samples);
-            audio_buffer_destroy(input_buffer);
-            audio_buffer_destroy(output_buffer);
-            free(input_data_b64);
-            free(metadata_json);
-            free(decoded_data);
-            redis_store_job_error(redis_client, job_id, "Failed to create WAV file");
-            redis_update_job_status(redis_client, job_id, "failed");
-            return -1;
+        const char *out_path = result_path ? result_path : derived_path;
+
+        double t0 = timing_now_ms();
+        if (write_file_atomic(out_path, wav_data, wav_size) != 0) {
+            redis_fail_job(redis_client, job_id, "Failed to write result file");
+            result = -1;
+        } else {
+            timing.total_ms = timing_now_ms() - start_ms;
+            char *updated_metadata = create_updated_metadata(metadata_json, job_id,
+                                                             &timing, 0, out_path);
+            redis_finish_job_meta(redis_client, job_id, updated_metadata);
+            job_timing_add(&timing, STAGE_REDIS_STORE, timing_now_ms() - t0);
+            free(updated_metadata);
+
+            timing.total_ms = timing_now_ms() - start_ms;
+            timing_record_job(&timing);
+
+            printf("Job %s completed successfully in %.2f ms\n", job_id, timing.total_ms);
         }
-        
-        free(pcm_samples);
-        
-        // Encode WAV data to base64
-        size_t encoded_size = base64_encoded_size(wav_size);
-        char *encoded_output = malloc(encoded_size + 1);
-        
-        if (encoded_output) {
-            base64_encode(wav_data, wav_size, encoded_output);
-            encoded_output[encoded_size] = '\0';
-            
-            // Store result
-            redis_store_job_result(redis_client, job_id, encoded_output);
-            
-            // Calculate processing time
-            clock_t end_time = clock();
-            double processing_time_ms = ((double)(end_time - start_time) / CLOCKS_PER_SEC) * 1000.0;
-            
-            // Update metadata
-            char *updated_metadata = create_updated_metadata(metadata_json, job_id, processing_time_ms);
-            if (updated_metadata) {
-                redis_update_job_metadata(redis_client, job_id, updated_metadata);
-                free(updated_metadata);
+
+        pool_free(wav_data);
+    } else if (result == 0 && wav_size >= RESULT_STREAM_MIN) {
+        // Large inline result: encode and upload in bounded chunks via
+        // APPEND to the result key. The full-size base64 copy and the
+        // result-sized hiredis command buffer both disappear - peak extra
+        // memory is one chunk - and the server handles a stream of small
+        // commands instead of one multi-megabyte SET. Readers still GET
+        // the same key, so nothing changes for producers.
+        timing.total_ms = timing_now_ms() - start_ms;
+        char *updated_metadata = create_updated_metadata(metadata_json, job_id,
+                                                         &timing, 0, NULL);
+
+        char *chunk_buf = NULL;
+        if (!raw_format) {
+            chunk_buf = pool_malloc(base64_encoded_size(RESULT_CHUNK_RAW) + 1);
+        }
+
+        double t0 = timing_now_ms();
+        double encode_ms = 0.0;
+        int store_rc = (!raw_format && !chunk_buf)
+                       ? -1 : redis_result_begin(redis_client, job_id);
+        for (size_t pos = 0; store_rc == 0 && pos < wav_size;
+             pos += RESULT_CHUNK_RAW) {
+            size_t n = wav_size - pos;
+            if (n > RESULT_CHUNK_RAW) n = RESULT_CHUNK_RAW;
+            if (raw_format) {
+                store_rc = redis_result_append(redis_client, job_id,
+                                               wav_data + pos, n);
+            } else {
+                double e0 = timing_now_ms();
+                base64_encode(wav_data + pos, n, chunk_buf);
+                encode_ms += timing_now_ms() - e0;
+                store_rc = redis_result_append(redis_client, job_id,
+                                               chunk_buf, base64_encoded_size(n));
             }
-            
-            // Update status to completed
-            redis_update_job_status(redis_client, job_id, "completed");
-            
-            printf("Job %s completed successfully in %.2f ms\n", job_id, processing_time_ms);
-            
-            free(encoded_output);
-            free(wav_data);
+        }
+        if (store_rc == 0) {
+            store_rc = redis_result_commit(redis_client, job_id, updated_metadata);
+        }
+        if (store_rc != 0) {
+            // Realign the connection and drop the partial value before
+            // the failure status (or any later job) reuses this client
+            redis_result_abort(redis_client, job_id);
+        }
+        if (store_rc == 0 && cacheable) {
+            redis_cache_store(redis_client, cache_key, job_id);
+        }
+        job_timing_add(&timing, STAGE_ENCODE, encode_ms);
+        job_timing_add(&timing, STAGE_REDIS_STORE, timing_now_ms() - t0 - encode_ms);
+        free(updated_metadata);
+        pool_free(chunk_buf);
+        pool_free(wav_data);
+
+        if (store_rc == 0) {
+            timing.total_ms = timing_now_ms() - start_ms;
+            timing_record_job(&timing);
+            printf("Job %s completed successfully in %.2f ms\n", job_id, timing.total_ms);
         } else {
-            free(wav_data);
-            redis_store_job_error(redis_client, job_id, "Failed to encode output data");
-            redis_update_job_status(redis_client, job_id, "failed");
+            redis_fail_job(redis_client, job_id, "Failed to store result");
             result = -1;
         }
+    } else if (result == 0) {
+        // format=raw jobs ship the WAV bytes as-is; legacy jobs pay the
+        // base64 expansion for their producers
+        char *encoded_output = NULL;
+        const void *result_data = wav_data;
+        size_t result_len = wav_size;
+
+        if (!raw_format) {
+            size_t encoded_size = base64_encoded_size(wav_size);
+            encoded_output = pool_malloc(encoded_size + 1);
+            if (encoded_output) {
+                double t0 = timing_now_ms();
+                base64_encode(wav_data, wav_size, encoded_output);
+                job_timing_add(&timing, STAGE_ENCODE, timing_now_ms() - t0);
+                encoded_output[encoded_size] = '\0';
+                result_data = encoded_output;
+                result_len = encoded_size;
+            }
+        }
+
+        if (raw_format || encoded_output) {
+            // Total is wall clock, measured before the metadata is built so
+            // the stored breakdown covers everything up to the final store
+            timing.total_ms = timing_now_ms() - start_ms;
+
+            // Store result + metadata + status in one pipelined round trip,
+            // then duplicate the result under the cache key for future hits
+            char *updated_metadata = create_updated_metadata(metadata_json, job_id, &timing, 0, NULL);
+            double t0 = timing_now_ms();
+            redis_finish_job(redis_client, job_id, result_data, result_len, updated_metadata);
+            if (cacheable) {
+                redis_cache_store(redis_client, cache_key, job_id);
+            }
+            job_timing_add(&timing, STAGE_REDIS_STORE, timing_now_ms() - t0);
+            free(updated_metadata);
+
+            timing.total_ms = timing_now_ms() - start_ms;
+            timing_record_job(&timing);
+
+            printf("Job %s completed successfully in %.2f ms\n", job_id, timing.total_ms);
+        } else {
+            redis_fail_job(redis_client, job_id, "Failed to encode output data");
+            result = -1;
+        }
+
+        pool_free(encoded_output);
+        pool_free(wav_data);
     } else {
-        redis_store_job_error(redis_client, job_id, "Audio processing failed");
-        redis_update_job_status(redis_client, job_id, "failed");
+        redis_fail_job(redis_client, job_id, "Audio processing failed");
     }
-    
+
+    // Failure paths never reach the total_ms updates above
+    if (result != 0) {
+        timing.total_ms = timing_now_ms() - start_ms;
+    }
+    publish_job_telemetry(redis_client, job_id, metadata_json,
+                          &timing, payload_len, result == 0);
+
     // Cleanup
-    audio_buffer_destroy(input_buffer);
-    audio_buffer_destroy(output_buffer);
-    free(input_data_b64);
+    if (mapped) {
+        munmap(mapped, mapped_len);
+    }
+    free(input_path);
+    free(result_path);
+    free(input_data);
     free(metadata_json);
-    free(decoded_data);
-    
+
     return result;
+}
+
+int process_redis_job(redis_client_t *redis_client, const char *job_id) {
+    if (!redis_client || !job_id) return -1;
+
+    // Mark processing and fetch input + metadata in one pipelined round trip
+    char *input_data = NULL;
+    size_t input_len = 0;
+    char *metadata_json = NULL;
+    double fetch_start = timing_now_ms();
+    int fetch_rc = redis_fetch_job(redis_client, job_id, &input_data, &input_len, &metadata_json);
+    double fetch_ms = timing_now_ms() - fetch_start;
+
+    if (fetch_rc != 0) {
+        fprintf(stderr, "Failed to fetch job input data\n");
+        redis_fail_job(redis_client, job_id, "Input data not found");
+        free(input_data);
+        free(metadata_json);
+        return -1;
+    }
+
+    return process_fetched_job(redis_client, job_id, input_data, input_len,
+                               metadata_json, fetch_ms);
 }
\ No newline at end of file
@@ -1,6 +1,14 @@
 #include "base64.h"
+#include "parallel.h"
 #include <string.h>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
 static int base64_char_to_value(char c) {
@@ -16,51 +24,46 @@ size_t base64_encoded_size(size_t input_len) {
     return ((input_len + 2) / 3) * 4;
 }
 
-size_t base64_decoded_size(const char *input) {
-    size_t len = strlen(input);
+size_t base64_decoded_size_len(const char *input, size_t input_len) {
     size_t padding = 0;
-    
-    if (len >= 1 && input[len - 1] == '=') padding++;
-    if (len >= 2 && input[len - 2] == '=') padding++;
-    
-    return (len * 3) / 4 - padding;
+
+    if (input_len >= 1 && input[input_len - 1] == '=') padding++;
+    if (input_len >= 2 && input[input_len - 2] == '=') padding++;
+
+    return (input_len * 3) / 4 - padding;
 }
 
-int base64_encode(const unsigned char *input, size_t input_len, char *output) {
-    if (!input || !output) return -1;
-    
+size_t base64_decoded_size(const char *input) {
+    return base64_decoded_size_len(input, strlen(input));
+}
+
+// Scalar kernels: the portable reference path, also used for block tails
+// after the vectorized main loops below.
+
+static void base64_encode_scalar(const unsigned char *input, size_t input_len, char *output) {
     size_t i, j;
     for (i = 0, j = 0; i < input_len; i += 3, j += 4) {
         unsigned int triple = (input[i] << 16);
-        
+
         if (i + 1 < input_len) {
             triple |= (input[i + 1] << 8);
         }
         if (i + 2 < input_len) {
             triple |= input[i + 2];
         }
-        
+
         output[j] = base64_chars[(triple >> 18) & 0x3F];
         output[j + 1] = base64_chars[(triple >> 12) & 0x3F];
         output[j + 2] = (i + 1 < input_len) ? base64_chars[(triple >> 6) & 0x3F] : '=';
         output[j + 3] = (i + 2 < input_len) ? base64_chars[triple & 0x3F] : '=';
     }
-    
-    output[j] = '\0';
-    return 0;
 }
 
-int base64_decode(const char *input, unsigned char *output, size_t *output_len) {
-    if (!input || !output || !output_len) return -1;
-    
-    size_t input_len = strlen(input);
-    if (input_len % 4 != 0) return -1;
-    
-    *output_len = 0;
-    
+static int base64_decode_scalar(const char *input, size_t input_len,
+                                unsigned char *output, size_t *output_len) {
     for (size_t i = 0; i < input_len; i += 4) {
         int values[4];
-        
+
         for (int j = 0; j < 4; j++) {
             if (input[i + j] == '=') {
                 values[j] = 0;
@@ -69,22 +72,453 @@ int base64_decode(const char *input, unsigned char *output, size_t *output_len)
                 if (values[j] == -1) return -1;
             }
         }
-        
+
         unsigned int triple = (values[0] << 18) | (values[1] << 12) | (values[2] << 6) | values[3];
-        
+
         output[*output_len] = (triple >> 16) & 0xFF;
         (*output_len)++;
-        
+
         if (input[i + 2] != '=') {
             output[*output_len] = (triple >> 8) & 0xFF;
             (*output_len)++;
         }
-        
+
         if (input[i + 3] != '=') {
             output[*output_len] = triple & 0xFF;
             (*output_len)++;
         }
     }
-    
+
     return 0;
-}
\ No newline at end of file
+}
+
+#if defined(__x86_64__)
+
+// AVX2 kernels based on the Mula/Langdale vectorized base64 algorithms:
+// 24 input bytes become 32 output chars per encode iteration, and 32
+// input chars become 24 output bytes per decode iteration. Compiled with
+// a target attribute so the baseline -march=x86-64 build still runs on
+// older CPUs; selected at runtime via __builtin_cpu_supports.
+
+static int avx2_available(void) {
+    static int checked = 0;
+    static int available = 0;
+    if (!checked) {
+        available = __builtin_cpu_supports("avx2");
+        checked = 1;
+    }
+    return available;
+}
+
+__attribute__((target("avx2")))
+static void base64_encode_avx2(const unsigned char *input, size_t input_len, char *output) {
+    size_t in_pos = 0;
+    size_t out_pos = 0;
+
+    // Each iteration reads 32 bytes (using 24) and writes 32 chars; the
+    // >= 32 guard keeps the over-read in bounds.
+    while (input_len - in_pos >= 32) {
+        __m256i in = _mm256_loadu_si256((const __m256i *)(input + in_pos));
+
+        // Move bytes 0..11 into lane 0 and 12..23 into lane 1
+        in = _mm256_permutevar8x32_epi32(in, _mm256_setr_epi32(0, 1, 2, 2, 3, 4, 5, 5));
+
+        // Spread each 3-byte group into a dword laid out as [b1 b0 b2 b1]
+        in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        // Isolate and align the four 6-bit fields per dword
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t1, t3);
+
+        // Translate 6-bit indices to ASCII via per-range offsets
+        const __m256i offset_lut = _mm256_setr_epi8(
+            65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+            65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+        __m256i offsets = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i over_25 = _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25));
+        offsets = _mm256_sub_epi8(offsets, over_25);
+        __m256i chars = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offset_lut, offsets));
+
+        _mm256_storeu_si256((__m256i *)(output + out_pos), chars);
+
+        in_pos += 24;
+        out_pos += 32;
+    }
+
+    // Finish the tail (and all padding) with the scalar kernel
+    base64_encode_scalar(input + in_pos, input_len - in_pos, output + out_pos);
+}
+
+__attribute__((target("avx2")))
+static int base64_decode_avx2(const char *input, size_t input_len,
+                              unsigned char *output, size_t *output_len) {
+    size_t in_pos = 0;
+
+    // Nibble-based classification LUTs (Mula): lo & hi intersect to zero
+    // only for valid base64 characters.
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+
+    // Stop the vector loop well before the end so '=' padding is never
+    // seen here and the 32-byte store always has output slack behind it.
+    while (input_len - in_pos >= 64) {
+        __m256i in = _mm256_loadu_si256((const __m256i *)(input + in_pos));
+
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), _mm256_set1_epi8(0x0F));
+        __m256i lo_nibbles = _mm256_and_si256(in, _mm256_set1_epi8(0x0F));
+        __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+        __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+
+        if (!_mm256_testz_si256(lo, hi)) {
+            return -1; // invalid character in block
+        }
+
+        __m256i eq_2F = _mm256_cmpeq_epi8(in, mask_2F);
+        __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi_nibbles));
+        __m256i values = _mm256_add_epi8(in, roll);
+
+        // Pack 32 6-bit values down to 24 bytes
+        __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i packed = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        packed = _mm256_shuffle_epi8(packed, _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+        _mm256_storeu_si256((__m256i *)(output + *output_len), packed);
+
+        in_pos += 32;
+        *output_len += 24;
+    }
+
+    return base64_decode_scalar(input + in_pos, input_len - in_pos, output, output_len);
+}
+
+#endif // __x86_64__
+
+#if defined(__aarch64__)
+
+// NEON kernels: 48 bytes per encode iteration using a 64-byte TBL lookup
+// of the alphabet, 64 chars per decode iteration using range arithmetic.
+// NEON is baseline on armv8-a, so no runtime check is needed.
+
+static void base64_encode_neon(const unsigned char *input, size_t *in_pos_out,
+                               size_t input_len, char *output, size_t *out_pos_out) {
+    size_t in_pos = 0;
+    size_t out_pos = 0;
+
+    uint8x16x4_t lut;
+    lut.val[0] = vld1q_u8((const uint8_t *)base64_chars);
+    lut.val[1] = vld1q_u8((const uint8_t *)base64_chars + 16);
+    lut.val[2] = vld1q_u8((const uint8_t *)base64_chars + 32);
+    lut.val[3] = vld1q_u8((const uint8_t *)base64_chars + 48);
+
+    while (input_len - in_pos >= 48) {
+        uint8x16x3_t in = vld3q_u8(input + in_pos);
+
+        uint8x16x4_t indices;
+        indices.val[0] = vshrq_n_u8(in.val[0], 2);
+        indices.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[0], vdupq_n_u8(0x03)), 4),
+                                  vshrq_n_u8(in.val[1], 4));
+        indices.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(in.val[1], vdupq_n_u8(0x0F)), 2),
+                                  vshrq_n_u8(in.val[2], 6));
+        indices.val[3] = vandq_u8(in.val[2], vdupq_n_u8(0x3F));
+
+        uint8x16x4_t chars;
+        chars.val[0] = vqtbl4q_u8(lut, indices.val[0]);
+        chars.val[1] = vqtbl4q_u8(lut, indices.val[1]);
+        chars.val[2] = vqtbl4q_u8(lut, indices.val[2]);
+        chars.val[3] = vqtbl4q_u8(lut, indices.val[3]);
+
+        vst4q_u8((uint8_t *)(output + out_pos), chars);
+
+        in_pos += 48;
+        out_pos += 64;
+    }
+
+    *in_pos_out = in_pos;
+    *out_pos_out = out_pos;
+}
+
+static int base64_decode_neon(const char *input, size_t *in_pos_out, size_t input_len,
+                              unsigned char *output, size_t *output_len) {
+    size_t in_pos = 0;
+
+    // Leave the last 64 chars (incl. any padding) to the scalar kernel
+    while (input_len - in_pos >= 128) {
+        uint8x16x4_t in = vld4q_u8((const uint8_t *)(input + in_pos));
+
+        uint8x16x4_t values;
+        uint8x16_t invalid = vdupq_n_u8(0);
+
+        for (int i = 0; i < 4; i++) {
+            uint8x16_t c = in.val[i];
+            uint8x16_t is_upper = vandq_u8(vcgeq_u8(c, vdupq_n_u8('A')), vcleq_u8(c, vdupq_n_u8('Z')));
+            uint8x16_t is_lower = vandq_u8(vcgeq_u8(c, vdupq_n_u8('a')), vcleq_u8(c, vdupq_n_u8('z')));
+            uint8x16_t is_digit = vandq_u8(vcgeq_u8(c, vdupq_n_u8('0')), vcleq_u8(c, vdupq_n_u8('9')));
+            uint8x16_t is_plus = vceqq_u8(c, vdupq_n_u8('+'));
+            uint8x16_t is_slash = vceqq_u8(c, vdupq_n_u8('/'));
+
+            uint8x16_t value = vandq_u8(is_upper, vsubq_u8(c, vdupq_n_u8('A')));
+            value = vorrq_u8(value, vandq_u8(is_lower, vsubq_u8(c, vdupq_n_u8('a' - 26))));
+            value = vorrq_u8(value, vandq_u8(is_digit, vsubq_u8(c, vdupq_n_u8('0' - 52))));
+            value = vorrq_u8(value, vandq_u8(is_plus, vdupq_n_u8(62)));
+            value = vorrq_u8(value, vandq_u8(is_slash, vdupq_n_u8(63)));
+
+            uint8x16_t valid = vorrq_u8(vorrq_u8(is_upper, is_lower),
+                                        vorrq_u8(is_digit, vorrq_u8(is_plus, is_slash)));
+            invalid = vorrq_u8(invalid, vmvnq_u8(valid));
+            values.val[i] = value;
+        }
+
+        if (vmaxvq_u8(invalid) != 0) {
+            return -1; // invalid character in block
+        }
+
+        uint8x16x3_t out;
+        out.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+
+        vst3q_u8(output + *output_len, out);
+
+        in_pos += 64;
+        *output_len += 48;
+    }
+
+    *in_pos_out = in_pos;
+    return 0;
+}
+
+#endif // __aarch64__
+
+// Arch dispatch over one contiguous region. The public entry points call
+// these per-chunk when a clip is big enough to partition across cores, so
+// the kernels may not write past their own region (no NUL termination and
+// no store slack beyond the chunk's output).
+
+static void encode_dispatch(const unsigned char *input, size_t input_len, char *output) {
+#if defined(__x86_64__)
+    if (avx2_available()) {
+        base64_encode_avx2(input, input_len, output);
+        return;
+    }
+#elif defined(__aarch64__)
+    {
+        size_t in_pos = 0;
+        size_t out_pos = 0;
+        base64_encode_neon(input, &in_pos, input_len, output, &out_pos);
+        base64_encode_scalar(input + in_pos, input_len - in_pos, output + out_pos);
+        return;
+    }
+#endif
+
+    base64_encode_scalar(input, input_len, output);
+}
+
+static int decode_dispatch(const char *input, size_t input_len,
+                           unsigned char *output, size_t *output_len) {
+#if defined(__x86_64__)
+    if (avx2_available()) {
+        return base64_decode_avx2(input, input_len, output, output_len);
+    }
+#elif defined(__aarch64__)
+    {
+        size_t in_pos = 0;
+        if (base64_decode_neon(input, &in_pos, input_len, output, output_len) != 0) {
+            return -1;
+        }
+        return base64_decode_scalar(input + in_pos, input_len - in_pos, output, output_len);
+    }
+#endif
+
+    return base64_decode_scalar(input, input_len, output, output_len);
+}
+
+// Parallel partitioning: encode splits on 3-byte triples and decode on
+// 4-char quads, so every chunk boundary is also a group boundary and the
+// chunks' outputs butt together with no fixup pass.
+
+typedef struct {
+    const unsigned char *input;
+    char *output;
+} encode_ctx_t;
+
+static void encode_range(size_t start, size_t end, int chunk_index, void *arg) {
+    (void)chunk_index;
+    encode_ctx_t *ctx = arg;
+    encode_dispatch(ctx->input + start * 3, (end - start) * 3, ctx->output + start * 4);
+}
+
+typedef struct {
+    const char *input;
+    unsigned char *output;
+    int rc[PARALLEL_MAX_THREADS];
+} decode_ctx_t;
+
+static void decode_range(size_t start, size_t end, int chunk_index, void *arg) {
+    decode_ctx_t *ctx = arg;
+    size_t produced = 0;
+    int rc = decode_dispatch(ctx->input + start * 4, (end - start) * 4,
+                             ctx->output + start * 3, &produced);
+
+    // Interior quads must decode to exactly 3 bytes each; a short count
+    // means '=' padding appeared mid-stream, which the vector kernels
+    // already reject
+    ctx->rc[chunk_index] = (rc != 0 || produced != (end - start) * 3) ? -1 : 0;
+}
+
+int base64_encode(const unsigned char *input, size_t input_len, char *output) {
+    if (!input || !output) return -1;
+
+    size_t triples = input_len / 3;
+    encode_ctx_t ctx = { input, output };
+    parallel_for(triples, PARALLEL_GRAIN_MEMBOUND / 3, encode_range, &ctx);
+
+    // Partial final triple (and its padding) falls outside the partition
+    base64_encode_scalar(input + triples * 3, input_len - triples * 3,
+                         output + triples * 4);
+
+    output[base64_encoded_size(input_len)] = '\0';
+    return 0;
+}
+
+int base64_decode_len(const char *input, size_t input_len,
+                      unsigned char *output, size_t *output_len) {
+    if (!input || !output || !output_len) return -1;
+
+    if (input_len % 4 != 0) return -1;
+
+    *output_len = 0;
+    size_t quads = input_len / 4;
+    if (quads == 0) return 0;
+
+    // The final quad may carry padding and decode short, so it stays out
+    // of the partition and runs after the join
+    decode_ctx_t ctx;
+    ctx.input = input;
+    ctx.output = output;
+    int chunks = parallel_for(quads - 1, PARALLEL_GRAIN_MEMBOUND / 4,
+                              decode_range, &ctx);
+    for (int i = 0; i < chunks; i++) {
+        if (ctx.rc[i] != 0) return -1;
+    }
+
+    size_t tail_len = 0;
+    if (decode_dispatch(input + (quads - 1) * 4, 4,
+                        output + (quads - 1) * 3, &tail_len) != 0) {
+        return -1;
+    }
+
+    *output_len = (quads - 1) * 3 + tail_len;
+    return 0;
+}
+
+int base64_decode(const char *input, unsigned char *output, size_t *output_len) {
+    if (!input) return -1;
+    return base64_decode_len(input, strlen(input), output, output_len);
+}
+
+// Fused decode-to-float. Two base64 quads decode to exactly six bytes -
+// three int16 samples - so partitioning on quad pairs keeps every chunk
+// boundary on both a quad boundary and a sample boundary. Each chunk
+// decodes through a stack staging block small enough to stay in L1, so
+// the bytes are converted to float while still cache-hot and the payload
+// crosses memory once.
+#define DECODE_STAGE_BYTES (48 * 1024)
+
+typedef struct {
+    const char *input;
+    float *output;
+    int rc[PARALLEL_MAX_THREADS];
+} decode_float_ctx_t;
+
+static void decode_float_range(size_t start, size_t end, int chunk_index, void *arg) {
+    decode_float_ctx_t *ctx = arg;
+    const float scale = 1.0f / 32768.0f;
+    unsigned char stage[DECODE_STAGE_BYTES];
+    size_t pos = start;   // in quad pairs
+
+    while (pos < end) {
+        size_t groups = end - pos;
+        if (groups > DECODE_STAGE_BYTES / 6) groups = DECODE_STAGE_BYTES / 6;
+
+        size_t produced = 0;
+        if (decode_dispatch(ctx->input + pos * 8, groups * 8, stage, &produced) != 0 ||
+            produced != groups * 6) {
+            // Short output means '=' padding mid-stream
+            ctx->rc[chunk_index] = -1;
+            return;
+        }
+
+        const int16_t *pcm = (const int16_t *)stage;
+        float *out = ctx->output + pos * 3;
+        for (size_t i = 0; i < groups * 3; i++) {
+            out[i] = (float)pcm[i] * scale;
+        }
+
+        pos += groups;
+    }
+
+    ctx->rc[chunk_index] = 0;
+}
+
+int base64_decode_to_float(const char *input, size_t input_len,
+                           float *output, size_t *sample_count_out) {
+    if (!input || !output || !sample_count_out) return -1;
+
+    if (input_len % 4 != 0) return -1;
+
+    *sample_count_out = 0;
+    size_t quads = input_len / 4;
+    if (quads == 0) return 0;
+
+    // The last one or two quads may carry padding, so they stay out of
+    // the partition and decode after the join
+    size_t groups = (quads - 1) / 2;
+    size_t tail_quads = quads - groups * 2;
+
+    decode_float_ctx_t ctx;
+    ctx.input = input;
+    ctx.output = output;
+    int chunks = parallel_for(groups, PARALLEL_GRAIN_MEMBOUND / 8,
+                              decode_float_range, &ctx);
+    for (int i = 0; i < chunks; i++) {
+        if (ctx.rc[i] != 0) return -1;
+    }
+
+    unsigned char tail[6];
+    size_t tail_bytes = 0;
+    if (decode_dispatch(input + groups * 8, tail_quads * 4, tail, &tail_bytes) != 0) {
+        return -1;
+    }
+
+    const float scale = 1.0f / 32768.0f;
+    float *out = output + groups * 3;
+    size_t tail_samples = tail_bytes / sizeof(int16_t);   // drop a trailing odd byte
+    for (size_t i = 0; i < tail_samples; i++) {
+        int16_t s;
+        memcpy(&s, tail + i * 2, sizeof(s));
+        out[i] = (float)s * scale;
+    }
+
+    *sample_count_out = groups * 3 + tail_samples;
+    return 0;
+}
@@ -0,0 +1,228 @@
+#include "buffer_pool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define POOL_ALIGNMENT 64   // cache-line aligned carves for SIMD kernels
+#define POOL_MIN_BLOCK_SIZE (256 * 1024)
+#define POOL_REGISTRY_MAX 256  // matches the worker thread limit
+
+typedef struct pool_block {
+    struct pool_block *next;
+    size_t capacity;
+    size_t used;
+    unsigned char *data;
+} pool_block_t;
+
+struct buffer_pool {
+    pool_block_t *blocks;   // newest first
+    size_t total_capacity;
+    size_t total_used;
+};
+
+// Active pool for the calling thread; NULL means fall back to malloc
+static __thread buffer_pool_t *current_pool = NULL;
+
+// Registry of live pools so the metrics endpoint can report aggregate
+// occupancy. Registration is rare (thread start/stop), so a mutex is fine.
+static pthread_mutex_t registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+static buffer_pool_t *pool_registry[POOL_REGISTRY_MAX];
+static int registry_count = 0;
+
+static void registry_add(buffer_pool_t *pool) {
+    pthread_mutex_lock(&registry_mutex);
+    if (registry_count < POOL_REGISTRY_MAX) {
+        pool_registry[registry_count++] = pool;
+    }
+    pthread_mutex_unlock(&registry_mutex);
+}
+
+static void registry_remove(buffer_pool_t *pool) {
+    pthread_mutex_lock(&registry_mutex);
+    for (int i = 0; i < registry_count; i++) {
+        if (pool_registry[i] == pool) {
+            pool_registry[i] = pool_registry[--registry_count];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&registry_mutex);
+}
+
+void buffer_pool_global_stats(size_t *total_capacity, size_t *total_in_use,
+                              int *pool_count) {
+    size_t capacity = 0;
+    size_t in_use = 0;
+
+    pthread_mutex_lock(&registry_mutex);
+    for (int i = 0; i < registry_count; i++) {
+        capacity += buffer_pool_capacity(pool_registry[i]);
+        in_use += buffer_pool_in_use(pool_registry[i]);
+    }
+    if (pool_count) *pool_count = registry_count;
+    pthread_mutex_unlock(&registry_mutex);
+
+    if (total_capacity) *total_capacity = capacity;
+    if (total_in_use) *total_in_use = in_use;
+}
+
+static size_t align_up(size_t size) {
+    return (size + (POOL_ALIGNMENT - 1)) & ~(size_t)(POOL_ALIGNMENT - 1);
+}
+
+static pool_block_t* pool_block_create(size_t capacity) {
+    pool_block_t *block = malloc(sizeof(pool_block_t));
+    if (!block) return NULL;
+
+    if (posix_memalign((void**)&block->data, POOL_ALIGNMENT, capacity) != 0) {
+        free(block);
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->capacity = capacity;
+    block->used = 0;
+    return block;
+}
+
+buffer_pool_t* buffer_pool_create(size_t initial_block_size) {
+    buffer_pool_t *pool = malloc(sizeof(buffer_pool_t));
+    if (!pool) return NULL;
+
+    if (initial_block_size < POOL_MIN_BLOCK_SIZE) {
+        initial_block_size = POOL_MIN_BLOCK_SIZE;
+    }
+
+    pool->blocks = pool_block_create(initial_block_size);
+    if (!pool->blocks) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->total_capacity = initial_block_size;
+    pool->total_used = 0;
+    registry_add(pool);
+    return pool;
+}
+
+void buffer_pool_destroy(buffer_pool_t *pool) {
+    if (!pool) return;
+
+    registry_remove(pool);
+
+    pool_block_t *block = pool->blocks;
+    while (block) {
+        pool_block_t *next = block->next;
+        free(block->data);
+        free(block);
+        block = next;
+    }
+    free(pool);
+}
+
+void buffer_pool_reset(buffer_pool_t *pool) {
+    if (!pool) return;
+
+    // Rewind every block but keep the memory (high-water mark), so the
+    // next job of similar size allocates nothing from the heap
+    for (pool_block_t *block = pool->blocks; block; block = block->next) {
+        block->used = 0;
+    }
+    pool->total_used = 0;
+}
+
+size_t buffer_pool_capacity(const buffer_pool_t *pool) {
+    return pool ? pool->total_capacity : 0;
+}
+
+size_t buffer_pool_in_use(const buffer_pool_t *pool) {
+    return pool ? pool->total_used : 0;
+}
+
+void buffer_pool_bind(buffer_pool_t *pool) {
+    current_pool = pool;
+}
+
+void buffer_pool_unbind(void) {
+    current_pool = NULL;
+}
+
+static int pool_owns(const buffer_pool_t *pool, const void *ptr) {
+    if (!pool || !ptr) return 0;
+
+    const unsigned char *p = ptr;
+    for (const pool_block_t *block = pool->blocks; block; block = block->next) {
+        if (p >= block->data && p < block->data + block->capacity) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void* pool_carve(buffer_pool_t *pool, size_t size) {
+    size = align_up(size ? size : 1);
+
+    for (pool_block_t *block = pool->blocks; block; block = block->next) {
+        if (block->capacity - block->used >= size) {
+            void *ptr = block->data + block->used;
+            block->used += size;
+            pool->total_used += size;
+            return ptr;
+        }
+    }
+
+    // Grow: new block sized to the request or double the pool, whichever
+    // is larger, so repeated growth converges quickly
+    size_t block_size = pool->total_capacity;
+    if (block_size < size) block_size = size;
+
+    pool_block_t *block = pool_block_create(block_size);
+    if (!block) return NULL;
+
+    block->next = pool->blocks;
+    pool->blocks = block;
+    pool->total_capacity += block_size;
+
+    block->used = size;
+    pool->total_used += size;
+    return block->data;
+}
+
+void* pool_malloc(size_t size) {
+    if (current_pool) {
+        return pool_carve(current_pool, size);
+    }
+    return malloc(size);
+}
+
+void* pool_calloc(size_t count, size_t size) {
+    if (current_pool) {
+        if (size != 0 && count > SIZE_MAX / size) return NULL;
+        void *ptr = pool_carve(current_pool, count * size);
+        if (ptr) memset(ptr, 0, count * size);
+        return ptr;
+    }
+    return calloc(count, size);
+}
+
+void* pool_realloc(void *ptr, size_t old_size, size_t new_size) {
+    if (pool_owns(current_pool, ptr)) {
+        if (new_size <= old_size) return ptr;
+        void *new_ptr = pool_carve(current_pool, new_size);
+        if (new_ptr) memcpy(new_ptr, ptr, old_size);
+        return new_ptr;
+    }
+
+    // Plain heap pointer (or no pool bound): keep it on the heap so the
+    // ownership stays consistent for the eventual pool_free/free
+    return realloc(ptr, new_size);
+}
+
+void pool_free(void *ptr) {
+    if (!ptr) return;
+
+    // Arena memory is reclaimed wholesale by buffer_pool_reset
+    if (pool_owns(current_pool, ptr)) return;
+
+    free(ptr);
+}
@@ -0,0 +1,78 @@
+#include "fft.h"
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static int is_power_of_two(size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+// Shared worker: sign selects transform direction (-1 forward, +1 inverse)
+static void fft_transform(float *re, float *im, size_t n, int sign) {
+    // Bit-reversal permutation
+    size_t j = 0;
+    for (size_t i = 1; i < n; i++) {
+        size_t bit = n >> 1;
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+
+        if (i < j) {
+            float tmp = re[i]; re[i] = re[j]; re[j] = tmp;
+            tmp = im[i]; im[i] = im[j]; im[j] = tmp;
+        }
+    }
+
+    // Butterfly stages. The per-group twiddle is advanced by complex
+    // multiplication in double precision so rounding error does not
+    // accumulate over long stages.
+    for (size_t len = 2; len <= n; len <<= 1) {
+        double angle = sign * 2.0 * M_PI / (double)len;
+        double step_re = cos(angle);
+        double step_im = sin(angle);
+
+        for (size_t start = 0; start < n; start += len) {
+            double w_re = 1.0;
+            double w_im = 0.0;
+
+            for (size_t k = 0; k < len / 2; k++) {
+                size_t even = start + k;
+                size_t odd = even + len / 2;
+
+                float t_re = (float)(re[odd] * w_re - im[odd] * w_im);
+                float t_im = (float)(re[odd] * w_im + im[odd] * w_re);
+
+                re[odd] = re[even] - t_re;
+                im[odd] = im[even] - t_im;
+                re[even] += t_re;
+                im[even] += t_im;
+
+                double next_re = w_re * step_re - w_im * step_im;
+                w_im = w_re * step_im + w_im * step_re;
+                w_re = next_re;
+            }
+        }
+    }
+}
+
+int fft_forward(float *re, float *im, size_t n) {
+    if (!re || !im || !is_power_of_two(n)) return -1;
+    fft_transform(re, im, n, -1);
+    return 0;
+}
+
+int fft_inverse(float *re, float *im, size_t n) {
+    if (!re || !im || !is_power_of_two(n)) return -1;
+    fft_transform(re, im, n, 1);
+
+    float scale = 1.0f / (float)n;
+    for (size_t i = 0; i < n; i++) {
+        re[i] *= scale;
+        im[i] *= scale;
+    }
+    return 0;
+}
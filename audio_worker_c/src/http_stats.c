@@ -0,0 +1,238 @@
+#include "http_stats.h"
+#include "job_timing.h"
+#include "buffer_pool.h"
+#include "redis_client.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+
+#define METRICS_BUF_SIZE (64 * 1024)
+#define REQUEST_BUF_SIZE 1024
+
+static pthread_t listener_thread;
+static volatile int listener_running = 0;
+static int listen_fd = -1;
+static time_t server_start_time;
+
+// Counters fed by the worker loops
+static pthread_mutex_t counter_mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long long jobs_ok = 0;
+static unsigned long long jobs_err = 0;
+static unsigned long long polls_with_job = 0;
+static unsigned long long polls_empty = 0;
+static double job_wait_ms_sum = 0.0;   // BRPOP wait before receiving a job
+static double idle_ms_sum = 0.0;       // BRPOP waits that timed out empty
+
+void http_stats_record_job(int success) {
+    pthread_mutex_lock(&counter_mutex);
+    if (success) {
+        jobs_ok++;
+    } else {
+        jobs_err++;
+    }
+    pthread_mutex_unlock(&counter_mutex);
+}
+
+void http_stats_record_poll(double wait_ms, int got_job) {
+    pthread_mutex_lock(&counter_mutex);
+    if (got_job) {
+        polls_with_job++;
+        job_wait_ms_sum += wait_ms;
+    } else {
+        polls_empty++;
+        idle_ms_sum += wait_ms;
+    }
+    pthread_mutex_unlock(&counter_mutex);
+}
+
+static unsigned long write_metrics(char *buf, unsigned long buf_size) {
+    pthread_mutex_lock(&counter_mutex);
+    unsigned long long ok = jobs_ok;
+    unsigned long long err = jobs_err;
+    unsigned long long hits = polls_with_job;
+    unsigned long long empty = polls_empty;
+    double wait_sum = job_wait_ms_sum;
+    double idle_sum = idle_ms_sum;
+    pthread_mutex_unlock(&counter_mutex);
+
+    size_t pool_capacity = 0;
+    size_t pool_in_use = 0;
+    int pool_count = 0;
+    buffer_pool_global_stats(&pool_capacity, &pool_in_use, &pool_count);
+
+    unsigned long pos = 0;
+    pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+        "# HELP audio_worker_jobs_total Jobs processed, by outcome\n"
+        "# TYPE audio_worker_jobs_total counter\n"
+        "audio_worker_jobs_total{result=\"success\"} %llu\n"
+        "audio_worker_jobs_total{result=\"failure\"} %llu\n",
+        ok, err);
+
+    pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+        "# HELP audio_worker_queue_wait_ms_sum Total BRPOP wait before jobs arrived\n"
+        "# TYPE audio_worker_queue_wait_ms_sum counter\n"
+        "audio_worker_queue_wait_ms_sum %.3f\n"
+        "# HELP audio_worker_queue_polls_total Queue polls, by outcome\n"
+        "# TYPE audio_worker_queue_polls_total counter\n"
+        "audio_worker_queue_polls_total{result=\"job\"} %llu\n"
+        "audio_worker_queue_polls_total{result=\"empty\"} %llu\n"
+        "# HELP audio_worker_idle_ms_total Total time spent in empty queue polls\n"
+        "# TYPE audio_worker_idle_ms_total counter\n"
+        "audio_worker_idle_ms_total %.3f\n",
+        wait_sum, hits, empty, idle_sum);
+
+    int lanes = redis_queue_lane_count();
+    if (lanes > 0) {
+        pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+            "# HELP audio_worker_queue_lane_jobs_total Jobs popped, by priority lane\n"
+            "# TYPE audio_worker_queue_lane_jobs_total counter\n");
+        for (int i = 0; i < lanes; i++) {
+            pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+                "audio_worker_queue_lane_jobs_total{queue=\"%s\"} %llu\n",
+                redis_queue_lane_name(i), redis_queue_lane_pops(i));
+        }
+    }
+
+    pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+        "# HELP audio_worker_redis_errors_total Redis failures (broken connections, error replies)\n"
+        "# TYPE audio_worker_redis_errors_total counter\n"
+        "audio_worker_redis_errors_total %llu\n",
+        redis_client_error_count());
+
+    pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+        "# HELP audio_worker_pool_capacity_bytes Aggregate buffer pool capacity\n"
+        "# TYPE audio_worker_pool_capacity_bytes gauge\n"
+        "audio_worker_pool_capacity_bytes %zu\n"
+        "# HELP audio_worker_pool_in_use_bytes Aggregate buffer pool occupancy\n"
+        "# TYPE audio_worker_pool_in_use_bytes gauge\n"
+        "audio_worker_pool_in_use_bytes %zu\n"
+        "# HELP audio_worker_pools Live buffer pools (one per worker thread)\n"
+        "# TYPE audio_worker_pools gauge\n"
+        "audio_worker_pools %d\n",
+        pool_capacity, pool_in_use, pool_count);
+
+    pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+        "# HELP audio_worker_uptime_seconds Seconds since worker start\n"
+        "# TYPE audio_worker_uptime_seconds gauge\n"
+        "audio_worker_uptime_seconds %.0f\n",
+        difftime(time(NULL), server_start_time));
+
+    if (pos < buf_size) {
+        pos += timing_write_prometheus(buf + pos, buf_size - pos);
+    }
+
+    return pos < buf_size ? pos : buf_size - 1;
+}
+
+static void send_response(int fd, const char *status, const char *content_type,
+                          const char *body, unsigned long body_len) {
+    char header[256];
+    int header_len = snprintf(header, sizeof(header),
+        "HTTP/1.1 %s\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %lu\r\n"
+        "Connection: close\r\n"
+        "\r\n",
+        status, content_type, body_len);
+
+    if (write(fd, header, header_len) < 0) return;
+    if (body_len > 0 && write(fd, body, body_len) < 0) return;
+}
+
+static void handle_request(int fd, char *metrics_buf) {
+    char request[REQUEST_BUF_SIZE];
+    ssize_t n = read(fd, request, sizeof(request) - 1);
+    if (n <= 0) return;
+    request[n] = '\0';
+
+    if (strncmp(request, "GET /health", 11) == 0) {
+        const char *body = "{\"status\":\"healthy\"}\n";
+        send_response(fd, "200 OK", "application/json", body, strlen(body));
+    } else if (strncmp(request, "GET /metrics", 12) == 0) {
+        unsigned long len = write_metrics(metrics_buf, METRICS_BUF_SIZE);
+        send_response(fd, "200 OK", "text/plain; version=0.0.4", metrics_buf, len);
+    } else {
+        const char *body = "Not Found\n";
+        send_response(fd, "404 Not Found", "text/plain", body, strlen(body));
+    }
+}
+
+static void* listener_main(void *arg) {
+    (void)arg;
+
+    char *metrics_buf = malloc(METRICS_BUF_SIZE);
+    if (!metrics_buf) return NULL;
+
+    while (listener_running) {
+        // Poll with a timeout so shutdown is prompt even with no traffic
+        struct pollfd pfd = { listen_fd, POLLIN, 0 };
+        int ready = poll(&pfd, 1, 500);
+        if (ready <= 0) continue;
+
+        int client_fd = accept(listen_fd, NULL, NULL);
+        if (client_fd < 0) continue;
+
+        handle_request(client_fd, metrics_buf);
+        close(client_fd);
+    }
+
+    free(metrics_buf);
+    return NULL;
+}
+
+int http_stats_start(int port) {
+    if (listener_running || port <= 0 || port > 65535) return -1;
+
+    listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        fprintf(stderr, "Failed to create metrics socket\n");
+        return -1;
+    }
+
+    int reuse = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((unsigned short)port);
+
+    if (bind(listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(listen_fd, 16) < 0) {
+        fprintf(stderr, "Failed to bind metrics endpoint to port %d\n", port);
+        close(listen_fd);
+        listen_fd = -1;
+        return -1;
+    }
+
+    server_start_time = time(NULL);
+    listener_running = 1;
+
+    if (pthread_create(&listener_thread, NULL, listener_main, NULL) != 0) {
+        fprintf(stderr, "Failed to start metrics listener thread\n");
+        listener_running = 0;
+        close(listen_fd);
+        listen_fd = -1;
+        return -1;
+    }
+
+    printf("Metrics endpoint listening on :%d (/health, /metrics)\n", port);
+    return 0;
+}
+
+void http_stats_stop(void) {
+    if (!listener_running) return;
+
+    listener_running = 0;
+    pthread_join(listener_thread, NULL);
+
+    close(listen_fd);
+    listen_fd = -1;
+}
@@ -0,0 +1,159 @@
+#include "job_timing.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+// Power-of-two millisecond buckets: <1, <2, <4, ... <1024, >=1024
+#define TIMING_BUCKETS 12
+
+typedef struct {
+    uint64_t buckets[TIMING_BUCKETS];
+    uint64_t count;
+    double sum_ms;
+    double max_ms;
+} stage_histogram_t;
+
+static stage_histogram_t stage_stats[STAGE_COUNT];
+static stage_histogram_t total_stats;
+static pthread_mutex_t timing_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *stage_names[STAGE_COUNT] = {
+    "redis_fetch",
+    "decode",
+    "low_pass",
+    "high_pass",
+    "reverb",
+    "echo",
+    "pitch_shift",
+    "distortion",
+    "effects_fused",
+    "normalize",
+    "wav_build",
+    "encode",
+    "redis_store",
+};
+
+double timing_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+void job_timing_reset(job_timing_t *timing) {
+    if (!timing) return;
+    memset(timing, 0, sizeof(*timing));
+}
+
+void job_timing_add(job_timing_t *timing, timing_stage_t stage, double elapsed_ms) {
+    if (!timing || stage >= STAGE_COUNT) return;
+    timing->stage_ms[stage] += elapsed_ms;
+}
+
+const char* timing_stage_name(timing_stage_t stage) {
+    return stage < STAGE_COUNT ? stage_names[stage] : "unknown";
+}
+
+static int bucket_index(double ms) {
+    int bucket = 0;
+    double bound = 1.0;
+    while (bucket < TIMING_BUCKETS - 1 && ms >= bound) {
+        bound *= 2.0;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void histogram_add(stage_histogram_t *hist, double ms) {
+    hist->buckets[bucket_index(ms)]++;
+    hist->count++;
+    hist->sum_ms += ms;
+    if (ms > hist->max_ms) hist->max_ms = ms;
+}
+
+void timing_record_job(const job_timing_t *timing) {
+    if (!timing) return;
+
+    pthread_mutex_lock(&timing_mutex);
+    for (int stage = 0; stage < STAGE_COUNT; stage++) {
+        if (timing->stage_ms[stage] > 0.0) {
+            histogram_add(&stage_stats[stage], timing->stage_ms[stage]);
+        }
+    }
+    histogram_add(&total_stats, timing->total_ms);
+    pthread_mutex_unlock(&timing_mutex);
+}
+
+static void print_histogram_line(const char *name, const stage_histogram_t *hist) {
+    if (hist->count == 0) return;
+
+    printf("  %-14s n=%-7llu avg=%8.2fms max=%8.2fms  [",
+           name, (unsigned long long)hist->count,
+           hist->sum_ms / (double)hist->count, hist->max_ms);
+
+    // Compact bucket dump: only the populated range
+    int last = 0;
+    for (int b = 0; b < TIMING_BUCKETS; b++) {
+        if (hist->buckets[b] > 0) last = b;
+    }
+    for (int b = 0; b <= last; b++) {
+        printf("%s%llu", b ? " " : "", (unsigned long long)hist->buckets[b]);
+    }
+    printf("] (<1ms..>=1s buckets, x2 each)\n");
+}
+
+unsigned long timing_write_prometheus(char *buf, unsigned long buf_size) {
+    unsigned long pos = 0;
+
+    pthread_mutex_lock(&timing_mutex);
+
+    pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+        "# HELP audio_worker_stage_duration_ms Per-stage job latency in milliseconds\n"
+        "# TYPE audio_worker_stage_duration_ms histogram\n");
+
+    for (int stage = 0; stage <= STAGE_COUNT; stage++) {
+        const stage_histogram_t *hist =
+            stage == STAGE_COUNT ? &total_stats : &stage_stats[stage];
+        const char *name = stage == STAGE_COUNT ? "total" : stage_names[stage];
+        if (hist->count == 0) continue;
+
+        uint64_t cumulative = 0;
+        double bound = 1.0;
+        for (int b = 0; b < TIMING_BUCKETS; b++) {
+            cumulative += hist->buckets[b];
+            if (b < TIMING_BUCKETS - 1) {
+                pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+                    "audio_worker_stage_duration_ms_bucket{stage=\"%s\",le=\"%g\"} %llu\n",
+                    name, bound, (unsigned long long)cumulative);
+                bound *= 2.0;
+            } else {
+                pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+                    "audio_worker_stage_duration_ms_bucket{stage=\"%s\",le=\"+Inf\"} %llu\n",
+                    name, (unsigned long long)cumulative);
+            }
+        }
+        pos += (unsigned long)snprintf(buf + pos, buf_size > pos ? buf_size - pos : 0,
+            "audio_worker_stage_duration_ms_sum{stage=\"%s\"} %.3f\n"
+            "audio_worker_stage_duration_ms_count{stage=\"%s\"} %llu\n",
+            name, hist->sum_ms, name, (unsigned long long)hist->count);
+    }
+
+    pthread_mutex_unlock(&timing_mutex);
+
+    return pos < buf_size ? pos : (buf_size ? buf_size - 1 : 0);
+}
+
+void timing_print_stats(void) {
+    pthread_mutex_lock(&timing_mutex);
+
+    if (total_stats.count > 0) {
+        printf("Stage timings (wall clock):\n");
+        for (int stage = 0; stage < STAGE_COUNT; stage++) {
+            print_histogram_line(stage_names[stage], &stage_stats[stage]);
+        }
+        print_histogram_line("total", &total_stats);
+    }
+
+    pthread_mutex_unlock(&timing_mutex);
+}
@@ -0,0 +1,307 @@
+#include "json_lite.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// --- Scanner -----------------------------------------------------------
+//
+// All skip functions take a cursor into the document and return the
+// position one past the token, or NULL on malformed input. Nothing here
+// allocates; values are reported as ranges into the source string.
+
+static const char* skip_ws(const char *p) {
+    while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r') p++;
+    return p;
+}
+
+// Past the closing quote of a string whose opening quote *p points at.
+// Escapes are skipped (not decoded); *saw_escape_out reports them so
+// lookups that hand out raw ranges can bail to the fallback parser.
+static const char* skip_string(const char *p, int *saw_escape_out) {
+    if (*p != '"') return NULL;
+    p++;
+    while (*p && *p != '"') {
+        if (*p == '\\') {
+            if (saw_escape_out) *saw_escape_out = 1;
+            p++;
+            if (!*p) return NULL;
+        }
+        p++;
+    }
+    return *p == '"' ? p + 1 : NULL;
+}
+
+static const char* skip_value(const char *p);
+
+static const char* skip_container(const char *p, char open, char close) {
+    p = skip_ws(p + 1);
+    if (*p == close) return p + 1;
+
+    for (;;) {
+        if (open == '{') {
+            p = skip_string(skip_ws(p), NULL);
+            if (!p) return NULL;
+            p = skip_ws(p);
+            if (*p != ':') return NULL;
+            p++;
+        }
+        p = skip_value(p);
+        if (!p) return NULL;
+        p = skip_ws(p);
+        if (*p == ',') {
+            p++;
+        } else if (*p == close) {
+            return p + 1;
+        } else {
+            return NULL;
+        }
+    }
+}
+
+static const char* skip_value(const char *p) {
+    p = skip_ws(p);
+    switch (*p) {
+    case '"':
+        return skip_string(p, NULL);
+    case '{':
+        return skip_container(p, '{', '}');
+    case '[':
+        return skip_container(p, '[', ']');
+    case 't':
+        return strncmp(p, "true", 4) == 0 ? p + 4 : NULL;
+    case 'f':
+        return strncmp(p, "false", 5) == 0 ? p + 5 : NULL;
+    case 'n':
+        return strncmp(p, "null", 4) == 0 ? p + 4 : NULL;
+    default:
+        if (*p == '-' || (*p >= '0' && *p <= '9')) {
+            if (*p == '-') p++;
+            if (!(*p >= '0' && *p <= '9')) return NULL;
+            while ((*p >= '0' && *p <= '9') || *p == '.' ||
+                   *p == 'e' || *p == 'E' || *p == '+' || *p == '-') {
+                p++;
+            }
+            return p;
+        }
+        return NULL;
+    }
+}
+
+// Walk the top-level object looking for key. Returns 1 with *value_out
+// at the value's first token, 0 if the object is well formed but the
+// key absent, -1 on malformed input.
+static int find_member(const char *json, const char *key, const char **value_out) {
+    if (!json || !key) return -1;
+    size_t key_len = strlen(key);
+
+    const char *p = skip_ws(json);
+    if (*p != '{') return -1;
+    p = skip_ws(p + 1);
+    if (*p == '}') return 0;
+
+    for (;;) {
+        p = skip_ws(p);
+        const char *name = p;
+        int escaped = 0;
+        p = skip_string(p, &escaped);
+        if (!p) return -1;
+        size_t name_len = (size_t)(p - name) - 2;
+
+        p = skip_ws(p);
+        if (*p != ':') return -1;
+        p = skip_ws(p + 1);
+
+        if (!escaped && name_len == key_len &&
+            memcmp(name + 1, key, key_len) == 0) {
+            *value_out = p;
+            return 1;
+        }
+
+        p = skip_value(p);
+        if (!p) return -1;
+        p = skip_ws(p);
+        if (*p == ',') {
+            p++;
+        } else if (*p == '}') {
+            return 0;
+        } else {
+            return -1;
+        }
+    }
+}
+
+int json_lite_get_string(const char *json, const char *key,
+                         const char **value_out, size_t *len_out) {
+    const char *value;
+    int rc = find_member(json, key, &value);
+    if (rc <= 0) return rc;
+
+    if (*value != '"') return -1;
+    int escaped = 0;
+    const char *end = skip_string(value, &escaped);
+    if (!end || escaped) return -1;
+
+    *value_out = value + 1;
+    *len_out = (size_t)(end - value) - 2;
+    return 1;
+}
+
+int json_lite_get_int(const char *json, const char *key, int *value_out) {
+    const char *value;
+    int rc = find_member(json, key, &value);
+    if (rc <= 0) return rc;
+
+    // Integer literals only; doubles, strings etc. report "absent" so
+    // the caller's fallback value applies, matching the strict
+    // json_type_int check this replaces
+    const char *p = value;
+    if (*p == '-') p++;
+    if (!(*p >= '0' && *p <= '9')) return 0;
+    while (*p >= '0' && *p <= '9') p++;
+    if (*p == '.' || *p == 'e' || *p == 'E') return 0;
+
+    *value_out = atoi(value);
+    return 1;
+}
+
+int json_lite_get_number(const char *json, const char *key, double *value_out) {
+    const char *value;
+    int rc = find_member(json, key, &value);
+    if (rc <= 0) return rc;
+
+    if (*value != '-' && !(*value >= '0' && *value <= '9')) return 0;
+
+    char *end = NULL;
+    double parsed = strtod(value, &end);
+    if (end == value) return 0;
+
+    *value_out = parsed;
+    return 1;
+}
+
+int json_lite_each_string(const char *json, const char *key,
+                          json_lite_string_fn fn, void *arg) {
+    const char *value;
+    int rc = find_member(json, key, &value);
+    if (rc <= 0) return rc;
+
+    if (*value != '[') return -1;
+    const char *p = skip_ws(value + 1);
+    if (*p == ']') return 1;
+
+    for (;;) {
+        p = skip_ws(p);
+        if (*p != '"') return -1;
+        const char *start = p;
+        int escaped = 0;
+        p = skip_string(p, &escaped);
+        if (!p || escaped) return -1;
+
+        rc = fn(start + 1, (size_t)(p - start) - 2, arg);
+        if (rc != 0) return rc;
+
+        p = skip_ws(p);
+        if (*p == ',') {
+            p++;
+        } else if (*p == ']') {
+            return 1;
+        } else {
+            return -1;
+        }
+    }
+}
+
+int json_lite_has_key(const char *json, const char *key) {
+    const char *value;
+    return find_member(json, key, &value);
+}
+
+int json_lite_object_end(const char *json, size_t *end_out, int *has_members_out) {
+    if (!json || !end_out || !has_members_out) return -1;
+
+    const char *p = skip_ws(json);
+    if (*p != '{') return -1;
+    const char *end = skip_container(p, '{', '}');
+    if (!end || *skip_ws(end) != '\0') return -1;
+
+    *end_out = (size_t)(end - 1 - json);
+    *has_members_out = *skip_ws(p + 1) != '}';
+    return 0;
+}
+
+// --- Writer ------------------------------------------------------------
+
+void json_writer_init(json_writer_t *w, char *buf, size_t cap) {
+    w->buf = buf;
+    w->cap = cap;
+    w->len = 0;
+    w->need_comma = 0;
+    w->error = (buf == NULL || cap == 0);
+}
+
+void json_writer_raw(json_writer_t *w, const char *data, size_t len) {
+    if (w->error) return;
+    // Keep one byte for the terminating NUL
+    if (len >= w->cap - w->len) {
+        w->error = 1;
+        return;
+    }
+    memcpy(w->buf + w->len, data, len);
+    w->len += len;
+    w->buf[w->len] = '\0';
+}
+
+static void writer_put(json_writer_t *w, char c) {
+    json_writer_raw(w, &c, 1);
+}
+
+static void writer_string(json_writer_t *w, const char *s) {
+    writer_put(w, '"');
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            writer_put(w, '\\');
+            writer_put(w, (char)c);
+        } else if (c < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            json_writer_raw(w, esc, 6);
+        } else {
+            writer_put(w, (char)c);
+        }
+    }
+    writer_put(w, '"');
+}
+
+static void writer_key(json_writer_t *w, const char *key) {
+    if (w->need_comma) writer_put(w, ',');
+    writer_string(w, key);
+    writer_put(w, ':');
+    w->need_comma = 1;
+}
+
+void json_writer_member_string(json_writer_t *w, const char *key, const char *value) {
+    writer_key(w, key);
+    writer_string(w, value);
+}
+
+void json_writer_member_double(json_writer_t *w, const char *key, double value) {
+    char num[32];
+    writer_key(w, key);
+    json_writer_raw(w, num, (size_t)snprintf(num, sizeof(num), "%.6g", value));
+}
+
+void json_writer_open_object(json_writer_t *w, const char *key) {
+    writer_key(w, key);
+    writer_put(w, '{');
+    w->need_comma = 0;
+}
+
+void json_writer_close_object(json_writer_t *w) {
+    writer_put(w, '}');
+    w->need_comma = 1;
+}
+
+int json_writer_ok(const json_writer_t *w) {
+    return !w->error;
+}
@@ -1,5 +1,7 @@
 #include "audio_processing.h"
 #include "redis_client.h"
+#include "buffer_pool.h"
+#include "http_stats.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,14 +9,63 @@
 #include <signal.h>
 #include <getopt.h>
 #include <time.h>
+#include <pthread.h>
 
 // Global flag for graceful shutdown
 static volatile int keep_running = 1;
-static int jobs_processed = 0;
 static time_t start_time;
 
-// External function from audio_job.c
+// Shared worker statistics (guarded by stats_mutex once threads start)
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int jobs_processed = 0;
+static int jobs_failed = 0;
+
+// Workers currently inside process_fetched_job, for the telemetry
+// heartbeat; atomic so the publisher never takes the stats mutex
+static volatile int jobs_in_flight = 0;
+
+// Seconds between telemetry heartbeats
+#define HEARTBEAT_INTERVAL 10
+
+// Single-slot mailbox between a worker's fetch stage and its compute
+// stage: while the worker crunches job N, the fetcher has already popped
+// job N+1 and staged its input and metadata here, so the queue pop and
+// input GET round trips overlap with compute instead of serializing.
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t ready;      // slot filled
+    pthread_cond_t consumed;   // slot emptied
+    int has_job;
+    int fetcher_done;
+    char *job_id;
+    char *entry_id;  // stream entry to XACK (NULL in list mode)
+    char *input_data;
+    size_t input_len;
+    char *metadata_json;
+    double fetch_ms;
+} prefetch_slot_t;
+
+// Per-thread worker context. Each worker owns two Redis connections (one
+// for the fetch stage, one for job completion) so the pool scales without
+// any locking around the clients.
+typedef struct {
+    int thread_index;
+    const char *redis_host;
+    int redis_port;
+    const char *redis_password;
+    int redis_db;
+    int poll_timeout;
+    time_t end_time;     // 0 = unlimited
+    int verbose;
+    pthread_t thread;
+    prefetch_slot_t slot;
+} worker_thread_t;
+
+// External functions from audio_job.c
 int process_redis_job(redis_client_t *redis_client, const char *job_id);
+int process_fetched_job(redis_client_t *redis_client, const char *job_id,
+                        char *input_data, size_t input_len, char *metadata_json,
+                        double fetch_ms);
 
 static void signal_handler(int sig) {
     (void)sig; // Unused parameter
@@ -32,6 +83,11 @@ static void print_usage(const char *program_name) {
     printf("  -d, --db DB         Redis database number (default: 0)\n");
     printf("  -t, --timeout SEC   Job poll timeout in seconds (default: 5)\n");
     printf("  -D, --duration MIN  Worker duration in minutes (default: 5, 0 = unlimited)\n");
+    printf("  -T, --threads N     Worker threads, each with its own Redis connection (default: 1)\n");
+    printf("  -M, --metrics-port P  HTTP /health and /metrics port (default: 9100, 0 = disabled)\n");
+    printf("  -Q, --queues LIST   Comma-separated queue keys, highest priority first\n");
+    printf("                      (default: audio:queue:interactive,audio:queue:default,\n");
+    printf("                      audio:queue:batch,audio:queue)\n");
     printf("  -v, --verbose       Enable verbose output\n");
     printf("  -V, --version       Show version information\n");
     printf("  --help              Show this help message\n\n");
@@ -39,10 +95,18 @@ static void print_usage(const char *program_name) {
     printf("  REDIS_HOST         Redis hostname\n");
     printf("  REDIS_PORT         Redis port\n");
     printf("  REDIS_PASSWORD     Redis password\n");
-    printf("  REDIS_DB           Redis database number\n\n");
+    printf("  REDIS_DB           Redis database number\n");
+    printf("  WORKER_THREADS     Worker thread count\n");
+    printf("  METRICS_PORT       HTTP /health and /metrics port\n");
+    printf("  QUEUE_BACKEND      'list' (BRPOP, default) or 'stream' (consumer\n");
+    printf("                     group on audio:stream with at-least-once delivery)\n");
+    printf("  QUEUE_KEYS         Ordered queue key list (see --queues)\n");
+    printf("  TELEMETRY_MAXLEN   Cap of the audio:telemetry stream (default 16384,\n");
+    printf("                     0 disables job telemetry and heartbeats)\n\n");
     printf("Examples:\n");
     printf("  %s --host redis.example.com --port 6380\n", program_name);
     printf("  %s --duration 10 --verbose\n", program_name);
+    printf("  %s --threads 8\n", program_name);
     printf("  REDIS_HOST=redis.local %s\n", program_name);
 }
 
@@ -55,10 +119,222 @@ static void print_version(void) {
 static void print_stats(void) {
     time_t current_time = time(NULL);
     double elapsed = difftime(current_time, start_time);
-    double jobs_per_minute = elapsed > 0 ? (jobs_processed / elapsed) * 60.0 : 0.0;
-    
-    printf("Worker Stats - Elapsed: %.0fs, Jobs: %d, Rate: %.1f jobs/min\n",
-           elapsed, jobs_processed, jobs_per_minute);
+
+    pthread_mutex_lock(&stats_mutex);
+    int processed = jobs_processed;
+    int failed = jobs_failed;
+    pthread_mutex_unlock(&stats_mutex);
+
+    double jobs_per_minute = elapsed > 0 ? (processed / elapsed) * 60.0 : 0.0;
+
+    printf("Worker Stats - Elapsed: %.0fs, Jobs: %d, Failed: %d, Rate: %.1f jobs/min\n",
+           elapsed, processed, failed, jobs_per_minute);
+
+    int lanes = redis_queue_lane_count();
+    if (lanes > 0) {
+        printf("Queue pops -");
+        for (int i = 0; i < lanes; i++) {
+            printf(" %s: %llu%s", redis_queue_lane_name(i), redis_queue_lane_pops(i),
+                   i + 1 < lanes ? "," : "\n");
+        }
+    }
+
+    timing_print_stats();
+}
+
+static void record_job_result(int success) {
+    pthread_mutex_lock(&stats_mutex);
+    if (success) {
+        jobs_processed++;
+    } else {
+        jobs_failed++;
+    }
+    pthread_mutex_unlock(&stats_mutex);
+
+    http_stats_record_job(success);
+}
+
+// Fetch stage: pop the next job and stream its input and metadata into
+// the prefetch slot on a dedicated connection, so the network round trips
+// run while the compute stage is busy with the previous job.
+static void* fetcher_thread_main(void *arg) {
+    worker_thread_t *ctx = (worker_thread_t*)arg;
+    prefetch_slot_t *slot = &ctx->slot;
+
+    redis_client_t *redis_client = redis_client_create(ctx->redis_host, ctx->redis_port,
+                                                       ctx->redis_password, ctx->redis_db);
+    if (!redis_client || redis_client_connect(redis_client) != 0 ||
+        redis_client_ping(redis_client) != 0) {
+        fprintf(stderr, "[thread %d] Fetcher failed to connect to Redis\n", ctx->thread_index);
+        redis_client_destroy(redis_client);
+        pthread_mutex_lock(&slot->lock);
+        slot->fetcher_done = 1;
+        pthread_cond_signal(&slot->ready);
+        pthread_mutex_unlock(&slot->lock);
+        return NULL;
+    }
+
+    while (keep_running) {
+        if (ctx->end_time != 0 && time(NULL) >= ctx->end_time) {
+            break;
+        }
+
+        // Pop job from queue; the wait feeds the queue-pressure metrics
+        double poll_start = timing_now_ms();
+        char *job_id = redis_pop_job(redis_client, ctx->poll_timeout);
+        http_stats_record_poll(timing_now_ms() - poll_start, job_id != NULL);
+
+        if (!job_id) {
+            if (ctx->verbose) {
+                printf("[thread %d] No jobs available, waiting...\n", ctx->thread_index);
+            }
+            continue;
+        }
+
+        // Stream mode: the entry stays pending until the compute stage
+        // records an outcome and acks, so a crash between here and there
+        // leaves it reclaimable via XAUTOCLAIM
+        char *entry_id = redis_client_take_entry_id(redis_client);
+
+        char *input_data = NULL;
+        size_t input_len = 0;
+        char *metadata_json = NULL;
+        double fetch_start = timing_now_ms();
+        int rc = redis_fetch_job(redis_client, job_id, &input_data, &input_len, &metadata_json);
+        double fetch_ms = timing_now_ms() - fetch_start;
+
+        // A NULL input with rc 0 is a path-transport job; the compute
+        // stage resolves the file reference from the metadata
+        if (rc != 0) {
+            fprintf(stderr, "Failed to fetch job input data\n");
+            redis_fail_job(redis_client, job_id, "Input data not found");
+            record_job_result(0);
+            redis_ack_job(redis_client, entry_id);
+            free(entry_id);
+            free(job_id);
+            free(input_data);
+            free(metadata_json);
+            continue;
+        }
+
+        // Hand the staged job to the compute stage; the slot holds at most
+        // one job so the fetcher runs exactly one job ahead
+        pthread_mutex_lock(&slot->lock);
+        while (slot->has_job) {
+            pthread_cond_wait(&slot->consumed, &slot->lock);
+        }
+        slot->job_id = job_id;
+        slot->entry_id = entry_id;
+        slot->input_data = input_data;
+        slot->input_len = input_len;
+        slot->metadata_json = metadata_json;
+        slot->fetch_ms = fetch_ms;
+        slot->has_job = 1;
+        pthread_cond_signal(&slot->ready);
+        pthread_mutex_unlock(&slot->lock);
+    }
+
+    pthread_mutex_lock(&slot->lock);
+    slot->fetcher_done = 1;
+    pthread_cond_signal(&slot->ready);
+    pthread_mutex_unlock(&slot->lock);
+
+    redis_client_destroy(redis_client);
+    return NULL;
+}
+
+// Compute stage for a single worker: consume staged jobs until the fetch
+// stage shuts down (staged work is drained, never dropped). Connection
+// failures terminate only this worker.
+static void* worker_thread_main(void *arg) {
+    worker_thread_t *ctx = (worker_thread_t*)arg;
+    prefetch_slot_t *slot = &ctx->slot;
+
+    redis_client_t *redis_client = redis_client_create(ctx->redis_host, ctx->redis_port,
+                                                       ctx->redis_password, ctx->redis_db);
+    if (!redis_client) {
+        fprintf(stderr, "[thread %d] Failed to create Redis client\n", ctx->thread_index);
+        return NULL;
+    }
+
+    if (redis_client_connect(redis_client) != 0 || redis_client_ping(redis_client) != 0) {
+        fprintf(stderr, "[thread %d] Failed to connect to Redis\n", ctx->thread_index);
+        redis_client_destroy(redis_client);
+        return NULL;
+    }
+
+    if (ctx->verbose) {
+        printf("[thread %d] Connected to Redis, waiting for jobs...\n", ctx->thread_index);
+    }
+
+    // Job-scoped allocations (buffers, scratch, codec output) come from a
+    // per-thread arena that is rewound between jobs, so steady-state
+    // processing does no heap allocation.
+    buffer_pool_t *pool = buffer_pool_create(4 * 1024 * 1024);
+    if (!pool) {
+        fprintf(stderr, "[thread %d] Failed to create buffer pool\n", ctx->thread_index);
+        redis_client_destroy(redis_client);
+        return NULL;
+    }
+    buffer_pool_bind(pool);
+
+    pthread_t fetcher;
+    if (pthread_create(&fetcher, NULL, fetcher_thread_main, ctx) != 0) {
+        fprintf(stderr, "[thread %d] Failed to start fetch stage\n", ctx->thread_index);
+        buffer_pool_unbind();
+        buffer_pool_destroy(pool);
+        redis_client_destroy(redis_client);
+        return NULL;
+    }
+
+    while (1) {
+        pthread_mutex_lock(&slot->lock);
+        while (!slot->has_job && !slot->fetcher_done) {
+            pthread_cond_wait(&slot->ready, &slot->lock);
+        }
+        if (!slot->has_job) {
+            pthread_mutex_unlock(&slot->lock);
+            break;
+        }
+
+        char *job_id = slot->job_id;
+        char *entry_id = slot->entry_id;
+        char *input_data = slot->input_data;
+        size_t input_len = slot->input_len;
+        char *metadata_json = slot->metadata_json;
+        double fetch_ms = slot->fetch_ms;
+        slot->has_job = 0;
+        pthread_cond_signal(&slot->consumed);
+        pthread_mutex_unlock(&slot->lock);
+
+        if (ctx->verbose) {
+            printf("[thread %d] Received job: %s\n", ctx->thread_index, job_id);
+        }
+
+        __sync_fetch_and_add(&jobs_in_flight, 1);
+        int rc = process_fetched_job(redis_client, job_id, input_data, input_len,
+                                     metadata_json, fetch_ms);
+        __sync_fetch_and_sub(&jobs_in_flight, 1);
+        record_job_result(rc == 0);
+        if (ctx->verbose) {
+            printf("[thread %d] Job %s: %s\n", ctx->thread_index, job_id,
+                   rc == 0 ? "completed" : "failed");
+        }
+
+        // Ack only after the outcome is recorded in Redis; failures count
+        // too (the job has a stored error), only crashes leave the entry
+        // for another consumer to reclaim. XACK works from any connection.
+        redis_ack_job(redis_client, entry_id);
+        free(entry_id);
+        free(job_id);
+        buffer_pool_reset(pool);
+    }
+
+    pthread_join(fetcher, NULL);
+    buffer_pool_unbind();
+    buffer_pool_destroy(pool);
+    redis_client_destroy(redis_client);
+    return NULL;
 }
 
 int main(int argc, char *argv[]) {
@@ -66,34 +342,53 @@ int main(int argc, char *argv[]) {
     char *redis_url = getenv("REDIS_URL");  // Priority 1: REDIS_URL
     char *redis_host = getenv("REDIS_HOST"); // Priority 2: Individual params
     char *redis_pass = getenv("REDIS_PASS"); // Use REDIS_PASS like Python version
-    
+
     // Default values
     if (!redis_host && !redis_url) redis_host = "localhost";
-    
+
     int redis_port = 6379;
     if (getenv("REDIS_PORT")) {
         redis_port = atoi(getenv("REDIS_PORT"));
     }
-    
+
     // Support both REDIS_PASSWORD and REDIS_PASS for compatibility
     char *redis_password = redis_pass ? redis_pass : getenv("REDIS_PASSWORD");
-    
+
     int redis_db = 0;
     if (getenv("REDIS_DB")) {
         redis_db = atoi(getenv("REDIS_DB"));
     }
-    
+
     // Handle REDIS_URL parsing (simplified - full URL parsing would need additional logic)
     if (redis_url && !redis_host) {
         // For now, log that REDIS_URL is set but we'll use individual params
         // Full URL parsing would require additional dependencies
         printf("Warning: REDIS_URL set but not fully parsed. Using individual env vars.\n");
     }
-    
+
     int poll_timeout = 5;
     int duration_minutes = 0;  // Default to unlimited duration
     int verbose = 0;
-    
+
+    int num_threads = 1;
+    if (getenv("WORKER_THREADS")) {
+        num_threads = atoi(getenv("WORKER_THREADS"));
+    }
+
+    // Metrics/health endpoint for Kubernetes probes and Prometheus scraping
+    int metrics_port = 9100;
+    if (getenv("METRICS_PORT")) {
+        metrics_port = atoi(getenv("METRICS_PORT"));
+    }
+
+    // Priority lanes watched in order; the legacy audio:queue rides last so
+    // producers that have not adopted the routing convention keep working
+    const char *queue_keys = getenv("QUEUE_KEYS");
+    if (!queue_keys) {
+        queue_keys = "audio:queue:interactive,audio:queue:default,"
+                     "audio:queue:batch,audio:queue";
+    }
+
     // Command line options
     static struct option long_options[] = {
         {"host",     required_argument, 0, 'h'},
@@ -102,14 +397,17 @@ int main(int argc, char *argv[]) {
         {"db",       required_argument, 0, 'd'},
         {"timeout",  required_argument, 0, 't'},
         {"duration", required_argument, 0, 'D'},
+        {"threads",  required_argument, 0, 'T'},
+        {"metrics-port", required_argument, 0, 'M'},
+        {"queues",   required_argument, 0, 'Q'},
         {"verbose",  no_argument,       0, 'v'},
         {"version",  no_argument,       0, 'V'},
         {"help",     no_argument,       0, '?'},
         {0, 0, 0, 0}
     };
-    
+
     int opt;
-    while ((opt = getopt_long(argc, argv, "h:p:a:d:t:D:vV?", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "h:p:a:d:t:D:T:M:Q:vV?", long_options, NULL)) != -1) {
         switch (opt) {
             case 'h':
                 redis_host = optarg;
@@ -145,6 +443,19 @@ int main(int argc, char *argv[]) {
                     return 1;
                 }
                 break;
+            case 'T':
+                num_threads = atoi(optarg);
+                break;
+            case 'M':
+                metrics_port = atoi(optarg);
+                if (metrics_port < 0 || metrics_port > 65535) {
+                    fprintf(stderr, "Invalid metrics port: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'Q':
+                queue_keys = optarg;
+                break;
             case 'v':
                 verbose = 1;
                 break;
@@ -157,13 +468,18 @@ int main(int argc, char *argv[]) {
                 return opt == '?' ? 0 : 1;
         }
     }
-    
+
+    if (num_threads < 1 || num_threads > 256) {
+        fprintf(stderr, "Invalid thread count: %d (expected 1-256)\n", num_threads);
+        return 1;
+    }
+
     // Validate Redis connection info (like Python version)
     if (!redis_host && !redis_url) {
         fprintf(stderr, "Redis connection not configured. Set REDIS_URL or REDIS_HOST\n");
         return 1;
     }
-    
+
     // Print configuration
     printf("Audio Worker C starting...\n");
     if (redis_url) {
@@ -171,97 +487,136 @@ int main(int argc, char *argv[]) {
     } else {
         printf("Redis: %s:%d (db: %d)\n", redis_host, redis_port, redis_db);
     }
-    
+
     // Simplify duration output
     if (duration_minutes == 0) {
-        printf("Poll timeout: %ds, Duration: unlimited\n", poll_timeout);
+        printf("Poll timeout: %ds, Duration: unlimited, Threads: %d\n", poll_timeout, num_threads);
     } else {
-        printf("Poll timeout: %ds, Duration: %d minute%s\n", 
-               poll_timeout, duration_minutes, duration_minutes == 1 ? "" : "s");
+        printf("Poll timeout: %ds, Duration: %d minute%s, Threads: %d\n",
+               poll_timeout, duration_minutes, duration_minutes == 1 ? "" : "s", num_threads);
+    }
+
+    if (redis_queues_configure(queue_keys) != 0) {
+        fprintf(stderr, "Invalid queue key list: %s\n", queue_keys);
+        return 1;
     }
-    
+
     // Setup signal handlers
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
-    
-    // Connect to Redis
-    redis_client_t *redis_client = redis_client_create(redis_host, redis_port, redis_password, redis_db);
-    if (!redis_client) {
-        fprintf(stderr, "Failed to create Redis client\n");
-        return 1;
+
+    start_time = time(NULL);
+    time_t end_time = (duration_minutes == 0) ? 0 : start_time + (duration_minutes * 60);
+
+    // Metrics endpoint failure is not fatal: the worker can still process
+    // jobs, it just stays invisible to probes and scraping
+    if (metrics_port > 0) {
+        http_stats_start(metrics_port);
     }
-    
-    if (redis_client_connect(redis_client) != 0) {
-        fprintf(stderr, "Failed to connect to Redis\n");
-        redis_client_destroy(redis_client);
+
+    // Spawn worker pool; each thread connects to Redis on its own
+    worker_thread_t *workers = calloc(num_threads, sizeof(worker_thread_t));
+    if (!workers) {
+        fprintf(stderr, "Failed to allocate worker pool\n");
         return 1;
     }
-    
-    // Test connection
-    if (redis_client_ping(redis_client) != 0) {
-        fprintf(stderr, "Redis ping failed\n");
-        redis_client_destroy(redis_client);
+
+    printf("Worker started with %d thread%s, waiting for jobs...\n",
+           num_threads, num_threads == 1 ? "" : "s");
+
+    int threads_started = 0;
+    for (int i = 0; i < num_threads; i++) {
+        workers[i].thread_index = i;
+        workers[i].redis_host = redis_host;
+        workers[i].redis_port = redis_port;
+        workers[i].redis_password = redis_password;
+        workers[i].redis_db = redis_db;
+        workers[i].poll_timeout = poll_timeout;
+        workers[i].end_time = end_time;
+        workers[i].verbose = verbose;
+
+        pthread_mutex_init(&workers[i].slot.lock, NULL);
+        pthread_cond_init(&workers[i].slot.ready, NULL);
+        pthread_cond_init(&workers[i].slot.consumed, NULL);
+
+        if (pthread_create(&workers[i].thread, NULL, worker_thread_main, &workers[i]) != 0) {
+            fprintf(stderr, "Failed to start worker thread %d\n", i);
+            break;
+        }
+        threads_started++;
+    }
+
+    if (threads_started == 0) {
+        fprintf(stderr, "No worker threads could be started\n");
+        free(workers);
         return 1;
     }
-    
-    if (verbose) {
-        printf("Successfully connected to Redis\n");
+
+    // Telemetry heartbeats ride on a main-thread connection; losing it
+    // (or telemetry being disabled) costs only the heartbeat feed
+    redis_client_t *heartbeat_client = NULL;
+    char heartbeat_host[256] = "";
+    if (redis_telemetry_enabled()) {
+        heartbeat_client = redis_client_create(redis_host, redis_port,
+                                               redis_password, redis_db);
+        if (heartbeat_client && redis_client_connect(heartbeat_client) != 0) {
+            redis_client_destroy(heartbeat_client);
+            heartbeat_client = NULL;
+        }
+        if (!heartbeat_client) {
+            fprintf(stderr, "Telemetry heartbeat connection failed; heartbeats disabled\n");
+        }
+        gethostname(heartbeat_host, sizeof(heartbeat_host));
+        heartbeat_host[sizeof(heartbeat_host) - 1] = '\0';
     }
-    
-    // Main worker loop
-    start_time = time(NULL);
-    time_t end_time = (duration_minutes == 0) ? 0 : start_time + (duration_minutes * 60);
+
+    // Main thread handles periodic stats, heartbeats and the duration limit
     time_t last_stats_time = start_time;
-    
-    printf("Worker started, waiting for jobs...\n");
-    
+    time_t last_heartbeat_time = start_time;
     while (keep_running) {
-        // Check duration limit
         if (end_time != 0 && time(NULL) >= end_time) {
             printf("Duration limit reached, shutting down...\n");
+            keep_running = 0;
             break;
         }
-        
-        // Pop job from queue
-        char *job_id = redis_pop_job(redis_client, poll_timeout);
-        
-        if (job_id) {
-            if (verbose) {
-                printf("Received job: %s\n", job_id);
-            }
-            
-            // Process the job
-            if (process_redis_job(redis_client, job_id) == 0) {
-                jobs_processed++;
-                if (verbose) {
-                    printf("Job completed: %s\n", job_id);
-                }
-            } else {
-                if (verbose) {
-                    printf("Job failed: %s\n", job_id);
-                }
-            }
-            
-            free(job_id);
-        } else {
-            if (verbose) {
-                printf("No jobs available, waiting...\n");
-            }
-        }
-        
-        // Print periodic stats
+
+        sleep(1);
+
         time_t current_time = time(NULL);
         if (current_time - last_stats_time >= 30) {
             print_stats();
             last_stats_time = current_time;
         }
+
+        if (heartbeat_client &&
+            current_time - last_heartbeat_time >= HEARTBEAT_INTERVAL) {
+            pthread_mutex_lock(&stats_mutex);
+            unsigned long long ok = (unsigned long long)jobs_processed;
+            unsigned long long failed = (unsigned long long)jobs_failed;
+            pthread_mutex_unlock(&stats_mutex);
+
+            size_t pool_capacity = 0, pool_in_use = 0;
+            int pool_count = 0;
+            buffer_pool_global_stats(&pool_capacity, &pool_in_use, &pool_count);
+
+            redis_telemetry_heartbeat(heartbeat_client, heartbeat_host,
+                                      threads_started, jobs_in_flight,
+                                      ok, failed, pool_in_use, pool_capacity);
+            last_heartbeat_time = current_time;
+        }
+    }
+
+    // Wait for in-flight jobs to finish (threads exit after their current pop)
+    for (int i = 0; i < threads_started; i++) {
+        pthread_join(workers[i].thread, NULL);
     }
-    
+    free(workers);
+    redis_client_destroy(heartbeat_client);
+
     // Final stats and cleanup
+    http_stats_stop();
     print_stats();
     printf("Worker shutting down. Processed %d jobs total.\n", jobs_processed);
-    
-    redis_client_destroy(redis_client);
-    
+
     return 0;
-}
\ No newline at end of file
+}
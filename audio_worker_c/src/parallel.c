@@ -0,0 +1,75 @@
+#include "parallel.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct {
+    parallel_range_fn fn;
+    void *arg;
+    size_t start;
+    size_t end;
+    int index;
+} parallel_task_t;
+
+static void* task_main(void *p) {
+    parallel_task_t *task = p;
+    task->fn(task->start, task->end, task->index, task->arg);
+    return NULL;
+}
+
+int parallel_worker_count(void) {
+    static int cached = 0;
+    if (cached == 0) {
+        const char *env = getenv("INTRA_JOB_THREADS");
+        long n = env ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+        if (n < 1) n = 1;
+        if (n > PARALLEL_MAX_THREADS) n = PARALLEL_MAX_THREADS;
+        cached = (int)n;
+    }
+    return cached;
+}
+
+int parallel_for(size_t length, size_t min_chunk,
+                 parallel_range_fn fn, void *arg) {
+    if (!fn) return -1;
+    if (length == 0) return 0;
+
+    // Below the grain (or with one worker) run inline: same code path,
+    // no thread traffic
+    int max_threads = parallel_worker_count();
+    size_t by_grain = min_chunk ? length / min_chunk : 1;
+    int n = by_grain < (size_t)max_threads ? (int)by_grain : max_threads;
+    if (n <= 1) {
+        fn(0, length, 0, arg);
+        return 1;
+    }
+
+    pthread_t threads[PARALLEL_MAX_THREADS];
+    parallel_task_t tasks[PARALLEL_MAX_THREADS];
+    int spawned[PARALLEL_MAX_THREADS] = {0};
+    size_t per = length / (size_t)n;
+
+    for (int i = 0; i < n; i++) {
+        tasks[i].fn = fn;
+        tasks[i].arg = arg;
+        tasks[i].index = i;
+        tasks[i].start = per * (size_t)i;
+        tasks[i].end = (i == n - 1) ? length : per * (size_t)(i + 1);
+    }
+
+    // Chunk 0 runs on the calling thread; a failed spawn degrades to
+    // running that chunk inline too
+    for (int i = 1; i < n; i++) {
+        spawned[i] = pthread_create(&threads[i], NULL, task_main, &tasks[i]) == 0;
+    }
+    task_main(&tasks[0]);
+    for (int i = 1; i < n; i++) {
+        if (spawned[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            task_main(&tasks[i]);
+        }
+    }
+
+    return n;
+}
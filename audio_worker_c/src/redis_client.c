@@ -3,22 +3,127 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <unistd.h>
+
+// Priority queues for the list backend, highest priority first. BRPOP
+// checks its keys in argument order, so a burst of batch jobs can never
+// head-of-line-block the interactive lane.
+#define QUEUE_MAX 8
+static char *queue_names[QUEUE_MAX];
+static int queue_count = 0;
+static volatile unsigned long long queue_pops[QUEUE_MAX];
+
+// Streams backend configuration
+#define STREAM_KEY "audio:stream"
+#define STREAM_GROUP "audio-workers"
+#define STREAM_MIN_IDLE_MS 60000        // reclaim entries idle longer than this
+#define STREAM_AUTOCLAIM_INTERVAL 16    // also probe for stale entries every N pops
+
+// Process-wide error counter for the metrics endpoint. BRPOP timeouts are
+// normal operation and are not counted.
+static volatile unsigned long long redis_errors = 0;
+
+static void note_redis_error(void) {
+    __sync_fetch_and_add(&redis_errors, 1ULL);
+}
+
+unsigned long long redis_client_error_count(void) {
+    return redis_errors;
+}
+
+int redis_queues_configure(const char *csv) {
+    if (!csv || !*csv) return -1;
+
+    char *copy = strdup(csv);
+    if (!copy) return -1;
+
+    char *names[QUEUE_MAX];
+    int count = 0;
+    char *save = NULL;
+    for (char *tok = strtok_r(copy, ",", &save);
+         tok && count < QUEUE_MAX;
+         tok = strtok_r(NULL, ",", &save)) {
+        while (*tok == ' ') tok++;
+        if (*tok) {
+            names[count] = strdup(tok);
+            if (!names[count]) {
+                for (int i = 0; i < count; i++) free(names[i]);
+                free(copy);
+                return -1;
+            }
+            count++;
+        }
+    }
+    free(copy);
+    if (count == 0) return -1;
+
+    for (int i = 0; i < queue_count; i++) free(queue_names[i]);
+    for (int i = 0; i < count; i++) queue_names[i] = names[i];
+    queue_count = count;
+    return 0;
+}
+
+int redis_queue_lane_count(void) {
+    return queue_count;
+}
+
+const char* redis_queue_lane_name(int index) {
+    if (index < 0 || index >= queue_count) return NULL;
+    return queue_names[index];
+}
+
+unsigned long long redis_queue_lane_pops(int index) {
+    if (index < 0 || index >= queue_count) return 0;
+    return queue_pops[index];
+}
+
+int redis_queue_uses_streams(void) {
+    static int cached = -1;
+    if (cached < 0) {
+        const char *backend = getenv("QUEUE_BACKEND");
+        cached = (backend && (strcmp(backend, "stream") == 0 ||
+                              strcmp(backend, "streams") == 0)) ? 1 : 0;
+    }
+    return cached;
+}
+
+// Unique consumer name within the group: host, pid and a per-process
+// sequence so every connection (worker and fetcher threads) is distinct
+static char* make_consumer_name(void) {
+    static volatile unsigned int sequence = 0;
+    unsigned int seq = __sync_fetch_and_add(&sequence, 1u);
+
+    char hostname[128];
+    if (gethostname(hostname, sizeof(hostname)) != 0) {
+        snprintf(hostname, sizeof(hostname), "unknown");
+    }
+    hostname[sizeof(hostname) - 1] = '\0';
+
+    char name[192];
+    snprintf(name, sizeof(name), "%s:%d:%u", hostname, (int)getpid(), seq);
+    return strdup(name);
+}
 
 redis_client_t* redis_client_create(const char *hostname, int port, const char *password, int db) {
     redis_client_t *client = malloc(sizeof(redis_client_t));
     if (!client) return NULL;
-    
+
     client->context = NULL;
     client->hostname = strdup(hostname ? hostname : "localhost");
     client->port = port > 0 ? port : 6379;
     client->password = password ? strdup(password) : NULL;
     client->db = db;
-    
-    if (!client->hostname) {
+    client->consumer_name = make_consumer_name();
+    client->pending_entry_id = NULL;
+    client->stream_group_ready = 0;
+    client->pop_count = 0;
+    client->result_inflight = 0;
+
+    if (!client->hostname || !client->consumer_name) {
         redis_client_destroy(client);
         return NULL;
     }
-    
+
     return client;
 }
 
@@ -29,6 +134,8 @@ void redis_client_destroy(redis_client_t *client) {
         }
         free(client->hostname);
         free(client->password);
+        free(client->consumer_name);
+        free(client->pending_entry_id);
         free(client);
     }
 }
@@ -44,6 +151,7 @@ int redis_client_connect(redis_client_t *client) {
             redisFree(client->context);
             client->context = NULL;
         }
+        note_redis_error();
         return -1;
     }
     
@@ -86,21 +194,638 @@ int redis_client_ping(redis_client_t *client) {
     return 0;
 }
 
+// Create the consumer group once per connection. BUSYGROUP means another
+// pod already created it, which is fine.
+static int stream_ensure_group(redis_client_t *client) {
+    if (client->stream_group_ready) return 0;
+
+    redisReply *reply = redisCommand(client->context,
+        "XGROUP CREATE %s %s 0 MKSTREAM", STREAM_KEY, STREAM_GROUP);
+    if (!reply) {
+        note_redis_error();
+        return -1;
+    }
+    if (reply->type == REDIS_REPLY_ERROR &&
+        strncmp(reply->str, "BUSYGROUP", 9) != 0) {
+        fprintf(stderr, "Failed to create consumer group: %s\n", reply->str);
+        freeReplyObject(reply);
+        note_redis_error();
+        return -1;
+    }
+    freeReplyObject(reply);
+
+    client->stream_group_ready = 1;
+    return 0;
+}
+
+// Pull the job id out of the first entry of an entries array
+// ([entry_id, [field, value, ...]]) and record its entry id on the
+// client for the eventual XACK. Returns NULL if the array is empty
+// or malformed.
+static char* stream_take_first_entry(redis_client_t *client, redisReply *entries) {
+    if (!entries || entries->type != REDIS_REPLY_ARRAY || entries->elements < 1) {
+        return NULL;
+    }
+
+    redisReply *entry = entries->element[0];
+    if (entry->type != REDIS_REPLY_ARRAY || entry->elements < 2 ||
+        entry->element[0]->type != REDIS_REPLY_STRING ||
+        entry->element[1]->type != REDIS_REPLY_ARRAY) {
+        return NULL;
+    }
+
+    redisReply *fields = entry->element[1];
+    char *job_id = NULL;
+    for (size_t i = 0; i + 1 < fields->elements; i += 2) {
+        if (fields->element[i]->type == REDIS_REPLY_STRING &&
+            strcmp(fields->element[i]->str, "job") == 0 &&
+            fields->element[i + 1]->type == REDIS_REPLY_STRING) {
+            job_id = strdup(fields->element[i + 1]->str);
+            break;
+        }
+    }
+    if (!job_id) return NULL;
+
+    free(client->pending_entry_id);
+    client->pending_entry_id = strdup(entry->element[0]->str);
+    if (!client->pending_entry_id) {
+        free(job_id);
+        return NULL;
+    }
+
+    return job_id;
+}
+
+// Reclaim one entry that a dead consumer popped but never acked
+static char* stream_autoclaim(redis_client_t *client) {
+    redisReply *reply = redisCommand(client->context,
+        "XAUTOCLAIM %s %s %s %d 0-0 COUNT 1",
+        STREAM_KEY, STREAM_GROUP, client->consumer_name, STREAM_MIN_IDLE_MS);
+    if (!reply) {
+        note_redis_error();
+        return NULL;
+    }
+
+    // Reply: [next-cursor, entries, (deleted-ids on Redis 7+)]
+    char *job_id = NULL;
+    if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 2) {
+        job_id = stream_take_first_entry(client, reply->element[1]);
+    }
+    freeReplyObject(reply);
+
+    return job_id;
+}
+
+static char* stream_pop_job(redis_client_t *client, int timeout_seconds) {
+    if (stream_ensure_group(client) != 0) return NULL;
+
+    // Periodically check for entries stranded by dead consumers before
+    // taking new work, so stale jobs do not starve behind a busy stream
+    client->pop_count++;
+    if (client->pop_count % STREAM_AUTOCLAIM_INTERVAL == 0) {
+        char *job_id = stream_autoclaim(client);
+        if (job_id) return job_id;
+    }
+
+    redisReply *reply = redisCommand(client->context,
+        "XREADGROUP GROUP %s %s COUNT 1 BLOCK %d STREAMS %s >",
+        STREAM_GROUP, client->consumer_name, timeout_seconds * 1000, STREAM_KEY);
+    if (!reply) {
+        note_redis_error();
+        return NULL;
+    }
+
+    // Reply: [[stream-name, entries], ...]; nil on timeout
+    char *job_id = NULL;
+    if (reply->type == REDIS_REPLY_ARRAY && reply->elements >= 1 &&
+        reply->element[0]->type == REDIS_REPLY_ARRAY &&
+        reply->element[0]->elements >= 2) {
+        job_id = stream_take_first_entry(client, reply->element[0]->element[1]);
+    }
+    freeReplyObject(reply);
+
+    // An empty poll is a cheap moment to look for stale entries
+    if (!job_id) {
+        job_id = stream_autoclaim(client);
+    }
+
+    return job_id;
+}
+
 char* redis_pop_job(redis_client_t *client, int timeout_seconds) {
     if (!client || !client->context) return NULL;
-    
-    redisReply *reply = redisCommand(client->context, "BRPOP audio:queue %d", timeout_seconds);
+
+    if (redis_queue_uses_streams()) {
+        return stream_pop_job(client, timeout_seconds);
+    }
+
+    redisReply *reply;
+    if (queue_count > 0) {
+        // One BRPOP over all lanes; Redis serves the leftmost non-empty
+        // key, so higher-priority lanes always drain first
+        const char *argv[QUEUE_MAX + 2];
+        size_t argvlen[QUEUE_MAX + 2];
+        char timeout_str[16];
+
+        int argc = 0;
+        argv[argc] = "BRPOP";
+        argvlen[argc] = 5;
+        argc++;
+        for (int i = 0; i < queue_count; i++) {
+            argv[argc] = queue_names[i];
+            argvlen[argc] = strlen(queue_names[i]);
+            argc++;
+        }
+        snprintf(timeout_str, sizeof(timeout_str), "%d", timeout_seconds);
+        argv[argc] = timeout_str;
+        argvlen[argc] = strlen(timeout_str);
+        argc++;
+
+        reply = redisCommandArgv(client->context, argc, argv, argvlen);
+    } else {
+        reply = redisCommand(client->context, "BRPOP audio:queue %d", timeout_seconds);
+    }
+
     if (!reply || reply->type != REDIS_REPLY_ARRAY || reply->elements != 2) {
         if (reply) freeReplyObject(reply);
         return NULL;
     }
-    
+
+    // element[0] names the lane that served the job
+    for (int i = 0; i < queue_count; i++) {
+        if (strcmp(reply->element[0]->str, queue_names[i]) == 0) {
+            __sync_fetch_and_add(&queue_pops[i], 1ULL);
+            break;
+        }
+    }
+
     char *job_id = strdup(reply->element[1]->str);
     freeReplyObject(reply);
-    
+
     return job_id;
 }
 
+char* redis_client_take_entry_id(redis_client_t *client) {
+    if (!client) return NULL;
+
+    char *entry_id = client->pending_entry_id;
+    client->pending_entry_id = NULL;
+    return entry_id;
+}
+
+int redis_ack_job(redis_client_t *client, const char *entry_id) {
+    if (!redis_queue_uses_streams() || !entry_id) return 0;
+    if (!client || !client->context) return -1;
+
+    redisReply *reply = redisCommand(client->context, "XACK %s %s %s",
+                                     STREAM_KEY, STREAM_GROUP, entry_id);
+    if (!reply || reply->type == REDIS_REPLY_ERROR) {
+        if (reply) freeReplyObject(reply);
+        note_redis_error();
+        return -1;
+    }
+
+    freeReplyObject(reply);
+    return 0;
+}
+
+// Drain one pipelined reply; returns NULL if the connection is broken.
+static redisReply* pipeline_get_reply(redis_client_t *client) {
+    redisReply *reply = NULL;
+    if (redisGetReply(client->context, (void**)&reply) != REDIS_OK) {
+        if (reply) freeReplyObject(reply);
+        note_redis_error();
+        return NULL;
+    }
+    if (reply && reply->type == REDIS_REPLY_ERROR) {
+        note_redis_error();
+    }
+    return reply;
+}
+
+int redis_fetch_job(redis_client_t *client, const char *job_id,
+                    char **input_data, size_t *input_len, char **metadata_json) {
+    if (!client || !client->context || !job_id || !input_data || !input_len ||
+        !metadata_json) return -1;
+
+    *input_data = NULL;
+    *input_len = 0;
+    *metadata_json = NULL;
+
+    // One flush for the whole job-start sequence: mark processing and
+    // fetch input + metadata.
+    redisAppendCommand(client->context, "SET audio:job:%s:status processing EX 3600", job_id);
+    redisAppendCommand(client->context, "GET audio:job:%s:input", job_id);
+    redisAppendCommand(client->context, "GET audio:job:%s:metadata", job_id);
+
+    int result = 0;
+
+    // Reply 1: status SET
+    redisReply *reply = pipeline_get_reply(client);
+    if (!reply) return -1;
+    if (reply->type == REDIS_REPLY_ERROR) result = -1;
+    freeReplyObject(reply);
+
+    // Reply 2: input data. Copy by reply length (binary-safe, and avoids
+    // the strlen pass strdup would make over a multi-megabyte payload);
+    // NUL-terminate so base64 text payloads stay usable as C strings.
+    // A nil input is not an error: path-transport jobs carry the payload
+    // on a shared volume and only reference it from the metadata.
+    reply = pipeline_get_reply(client);
+    if (!reply) return -1;
+    if (reply->type == REDIS_REPLY_STRING) {
+        *input_data = malloc(reply->len + 1);
+        if (*input_data) {
+            memcpy(*input_data, reply->str, reply->len);
+            (*input_data)[reply->len] = '\0';
+            *input_len = reply->len;
+        } else {
+            result = -1;
+        }
+    } else if (reply->type != REDIS_REPLY_NIL) {
+        result = -1;
+    }
+    freeReplyObject(reply);
+
+    // Reply 3: metadata (missing metadata is not an error)
+    reply = pipeline_get_reply(client);
+    if (!reply) {
+        free(*input_data);
+        *input_data = NULL;
+        *input_len = 0;
+        return -1;
+    }
+    if (reply->type == REDIS_REPLY_STRING) {
+        *metadata_json = strdup(reply->str);
+    } else {
+        *metadata_json = strdup("{}");
+    }
+    freeReplyObject(reply);
+
+    if (result != 0) {
+        free(*input_data);
+        free(*metadata_json);
+        *input_data = NULL;
+        *input_len = 0;
+        *metadata_json = NULL;
+    }
+
+    return result;
+}
+
+int redis_finish_job(redis_client_t *client, const char *job_id,
+                     const void *result_data, size_t result_len,
+                     const char *metadata_json) {
+    if (!client || !client->context || !job_id || !result_data) return -1;
+
+    // One flush for the whole job-completion sequence. %b keeps the result
+    // binary-safe for format=raw jobs.
+    int commands = 2;
+    redisAppendCommand(client->context, "SET audio:job:%s:result %b EX 3600",
+                       job_id, result_data, result_len);
+    if (metadata_json) {
+        redisAppendCommand(client->context, "SET audio:job:%s:metadata %s EX 3600",
+                           job_id, metadata_json);
+        commands++;
+    }
+    redisAppendCommand(client->context, "SET audio:job:%s:status completed EX 3600", job_id);
+
+    int result = 0;
+    for (int i = 0; i < commands; i++) {
+        redisReply *reply = pipeline_get_reply(client);
+        if (!reply) return -1;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+
+    return result;
+}
+
+int redis_finish_job_meta(redis_client_t *client, const char *job_id,
+                          const char *metadata_json) {
+    if (!client || !client->context || !job_id || !metadata_json) return -1;
+
+    // Completion for path-transport jobs: the payload lives on a shared
+    // volume, so only metadata and status touch Redis
+    redisAppendCommand(client->context, "SET audio:job:%s:metadata %s EX 3600",
+                       job_id, metadata_json);
+    redisAppendCommand(client->context, "SET audio:job:%s:status completed EX 3600", job_id);
+
+    int result = 0;
+    for (int i = 0; i < 2; i++) {
+        redisReply *reply = pipeline_get_reply(client);
+        if (!reply) return -1;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+
+    return result;
+}
+
+int redis_fail_job(redis_client_t *client, const char *job_id, const char *error_message) {
+    if (!client || !client->context || !job_id || !error_message) return -1;
+
+    redisAppendCommand(client->context, "SET audio:job:%s:error %s EX 3600",
+                       job_id, error_message);
+    redisAppendCommand(client->context, "SET audio:job:%s:status failed EX 3600", job_id);
+
+    int result = 0;
+    for (int i = 0; i < 2; i++) {
+        redisReply *reply = pipeline_get_reply(client);
+        if (!reply) return -1;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+
+    return result;
+}
+
+// Pipeline depth for chunked result appends: deep enough to hide the
+// round trip, shallow enough that hiredis never buffers more than a few
+// chunks of command data at once
+#define RESULT_APPEND_WINDOW 4
+
+// Drain in-flight append replies down to the given count. An error
+// reply (e.g. maxmemory) still consumes its slot so the connection's
+// reply stream stays aligned; a broken connection delivers no further
+// replies, so the in-flight count is simply forgotten.
+static int result_drain(redis_client_t *client, int down_to) {
+    int result = 0;
+    while (client->result_inflight > down_to) {
+        redisReply *reply = pipeline_get_reply(client);
+        if (!reply) {
+            client->result_inflight = 0;
+            return -1;
+        }
+        client->result_inflight--;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+    return result;
+}
+
+int redis_result_begin(redis_client_t *client, const char *job_id) {
+    if (!client || !client->context || !job_id) return -1;
+
+    // A retried job may have left a partial value behind; APPEND would
+    // silently extend it, so start from a clean key
+    client->result_inflight = 0;
+    redisReply *reply = redisCommand(client->context,
+                                     "DEL audio:job:%s:result", job_id);
+    if (!reply || reply->type == REDIS_REPLY_ERROR) {
+        if (reply) freeReplyObject(reply);
+        note_redis_error();
+        return -1;
+    }
+    freeReplyObject(reply);
+    return 0;
+}
+
+int redis_result_append(redis_client_t *client, const char *job_id,
+                        const void *chunk, size_t chunk_len) {
+    if (!client || !client->context || !job_id || !chunk) return -1;
+
+    redisAppendCommand(client->context, "APPEND audio:job:%s:result %b",
+                       job_id, chunk, chunk_len);
+    client->result_inflight++;
+
+    if (result_drain(client, RESULT_APPEND_WINDOW - 1) != 0) {
+        // The upload is doomed; drain the rest of the window now so the
+        // caller's next command on this connection reads its own replies
+        // instead of stale APPEND acks
+        result_drain(client, 0);
+        return -1;
+    }
+    return 0;
+}
+
+int redis_result_abort(redis_client_t *client, const char *job_id) {
+    if (!client || !client->context || !job_id) return -1;
+
+    // Realign the reply stream, then drop the partial value: it carries
+    // no TTL until commit lands the EXPIRE, so without the DEL it would
+    // sit in Redis indefinitely
+    result_drain(client, 0);
+
+    redisReply *reply = redisCommand(client->context,
+                                     "DEL audio:job:%s:result", job_id);
+    if (!reply || reply->type == REDIS_REPLY_ERROR) {
+        if (reply) freeReplyObject(reply);
+        note_redis_error();
+        return -1;
+    }
+    freeReplyObject(reply);
+    return 0;
+}
+
+int redis_result_commit(redis_client_t *client, const char *job_id,
+                        const char *metadata_json) {
+    if (!client || !client->context || !job_id) return -1;
+
+    if (result_drain(client, 0) != 0) return -1;
+
+    // Same completion sequence as redis_finish_job, minus the result SET
+    // the appends already did; the TTL lands once the value is whole
+    int commands = 2;
+    redisAppendCommand(client->context, "EXPIRE audio:job:%s:result 3600", job_id);
+    if (metadata_json) {
+        redisAppendCommand(client->context, "SET audio:job:%s:metadata %s EX 3600",
+                           job_id, metadata_json);
+        commands++;
+    }
+    redisAppendCommand(client->context, "SET audio:job:%s:status completed EX 3600", job_id);
+
+    int result = 0;
+    for (int i = 0; i < commands; i++) {
+        redisReply *reply = pipeline_get_reply(client);
+        if (!reply) return -1;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+
+    return result;
+}
+
+int redis_cache_complete_job(redis_client_t *client, const char *job_id,
+                             const char *cache_key, const char *metadata_json) {
+    if (!client || !client->context || !job_id || !cache_key) return -1;
+
+    // Server-side COPY moves the cached payload onto the job's result key
+    // without it crossing the network; reply 0 means no cache entry. The
+    // EXPIRE is a no-op on a miss (the result key does not exist yet).
+    redisAppendCommand(client->context, "COPY %s audio:job:%s:result REPLACE",
+                       cache_key, job_id);
+    redisAppendCommand(client->context, "EXPIRE audio:job:%s:result 3600", job_id);
+
+    int hit = 0;
+    redisReply *reply = pipeline_get_reply(client);
+    if (!reply) return -1;
+    if (reply->type == REDIS_REPLY_INTEGER && reply->integer == 1) hit = 1;
+    freeReplyObject(reply);
+
+    reply = pipeline_get_reply(client);
+    if (!reply) return -1;
+    freeReplyObject(reply);
+
+    if (!hit) return 0;
+
+    // Hit: finish the job without touching the payload again
+    int commands = 1;
+    if (metadata_json) {
+        redisAppendCommand(client->context, "SET audio:job:%s:metadata %s EX 3600",
+                           job_id, metadata_json);
+        commands++;
+    }
+    redisAppendCommand(client->context, "SET audio:job:%s:status completed EX 3600", job_id);
+
+    int result = 1;
+    for (int i = 0; i < commands; i++) {
+        reply = pipeline_get_reply(client);
+        if (!reply) return -1;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+
+    return result;
+}
+
+int redis_cache_store(redis_client_t *client, const char *cache_key, const char *job_id) {
+    if (!client || !client->context || !cache_key || !job_id) return -1;
+
+    // The result was just stored under the job key; duplicate it into the
+    // cache server-side instead of re-sending the payload
+    redisAppendCommand(client->context, "COPY audio:job:%s:result %s REPLACE",
+                       job_id, cache_key);
+    redisAppendCommand(client->context, "EXPIRE %s 3600", cache_key);
+
+    int result = 0;
+    for (int i = 0; i < 2; i++) {
+        redisReply *reply = pipeline_get_reply(client);
+        if (!reply) return -1;
+        if (reply->type == REDIS_REPLY_ERROR) result = -1;
+        freeReplyObject(reply);
+    }
+
+    return result;
+}
+
+// Telemetry stream: capped ring of per-job records and worker heartbeats
+#define TELEMETRY_KEY "audio:telemetry"
+#define TELEMETRY_MAXLEN_DEFAULT 16384
+
+static long telemetry_maxlen(void) {
+    static long cached = -1;
+    if (cached < 0) {
+        const char *env = getenv("TELEMETRY_MAXLEN");
+        cached = env ? atol(env) : TELEMETRY_MAXLEN_DEFAULT;
+        if (cached < 0) cached = 0;
+    }
+    return cached;
+}
+
+int redis_telemetry_enabled(void) {
+    return telemetry_maxlen() > 0;
+}
+
+// Fire one XADD and swallow the entry id. Telemetry must never fail a
+// job, so errors only bump the error counter.
+static int telemetry_xadd(redis_client_t *client, int argc,
+                          const char **argv, const size_t *argvlen) {
+    redisReply *reply = redisCommandArgv(client->context, argc, argv, argvlen);
+    if (!reply || reply->type == REDIS_REPLY_ERROR) {
+        if (reply) freeReplyObject(reply);
+        note_redis_error();
+        return -1;
+    }
+    freeReplyObject(reply);
+    return 0;
+}
+
+// Shared XADD prefix: XADD audio:telemetry MAXLEN ~ <cap> *
+static int telemetry_prefix(const char **argv, size_t *argvlen,
+                            char *maxlen_str, size_t maxlen_str_size) {
+    snprintf(maxlen_str, maxlen_str_size, "%ld", telemetry_maxlen());
+    int argc = 0;
+    argv[argc] = "XADD";           argvlen[argc] = 4;  argc++;
+    argv[argc] = TELEMETRY_KEY;    argvlen[argc] = strlen(TELEMETRY_KEY); argc++;
+    argv[argc] = "MAXLEN";         argvlen[argc] = 6;  argc++;
+    argv[argc] = "~";              argvlen[argc] = 1;  argc++;
+    argv[argc] = maxlen_str;       argvlen[argc] = strlen(maxlen_str); argc++;
+    argv[argc] = "*";              argvlen[argc] = 1;  argc++;
+    return argc;
+}
+
+#define TELEMETRY_FIELD(name, value) do { \
+        argv[argc] = (name);  argvlen[argc] = strlen(name);  argc++; \
+        argv[argc] = (value); argvlen[argc] = strlen(value); argc++; \
+    } while (0)
+
+int redis_telemetry_job(redis_client_t *client, const char *job_id,
+                        const char *hostname, double queue_wait_ms,
+                        double total_ms, size_t payload_bytes,
+                        const char *stages_json, int success) {
+    if (!redis_telemetry_enabled()) return 0;
+    if (!client || !client->context || !job_id) return -1;
+
+    char maxlen_str[24], wait_str[32], total_str[32], bytes_str[24];
+    const char *argv[26];
+    size_t argvlen[26];
+    int argc = telemetry_prefix(argv, argvlen, maxlen_str, sizeof(maxlen_str));
+
+    snprintf(total_str, sizeof(total_str), "%.3f", total_ms);
+    snprintf(bytes_str, sizeof(bytes_str), "%llu",
+             (unsigned long long)payload_bytes);
+
+    TELEMETRY_FIELD("kind", "job");
+    TELEMETRY_FIELD("job", job_id);
+    if (hostname) TELEMETRY_FIELD("host", hostname);
+    if (queue_wait_ms >= 0.0) {
+        snprintf(wait_str, sizeof(wait_str), "%.3f", queue_wait_ms);
+        TELEMETRY_FIELD("queue_wait_ms", wait_str);
+    }
+    TELEMETRY_FIELD("total_ms", total_str);
+    TELEMETRY_FIELD("bytes", bytes_str);
+    TELEMETRY_FIELD("ok", success ? "1" : "0");
+    if (stages_json) TELEMETRY_FIELD("stages", stages_json);
+
+    return telemetry_xadd(client, argc, argv, argvlen);
+}
+
+int redis_telemetry_heartbeat(redis_client_t *client, const char *hostname,
+                              int threads, int in_flight,
+                              unsigned long long jobs_ok,
+                              unsigned long long jobs_failed,
+                              size_t pool_in_use, size_t pool_capacity) {
+    if (!redis_telemetry_enabled()) return 0;
+    if (!client || !client->context) return -1;
+
+    char maxlen_str[24], threads_str[16], inflight_str[16];
+    char ok_str[24], failed_str[24], used_str[24], cap_str[24];
+    const char *argv[22];
+    size_t argvlen[22];
+    int argc = telemetry_prefix(argv, argvlen, maxlen_str, sizeof(maxlen_str));
+
+    snprintf(threads_str, sizeof(threads_str), "%d", threads);
+    snprintf(inflight_str, sizeof(inflight_str), "%d", in_flight);
+    snprintf(ok_str, sizeof(ok_str), "%llu", jobs_ok);
+    snprintf(failed_str, sizeof(failed_str), "%llu", jobs_failed);
+    snprintf(used_str, sizeof(used_str), "%llu",
+             (unsigned long long)pool_in_use);
+    snprintf(cap_str, sizeof(cap_str), "%llu",
+             (unsigned long long)pool_capacity);
+
+    TELEMETRY_FIELD("kind", "heartbeat");
+    if (hostname) TELEMETRY_FIELD("host", hostname);
+    TELEMETRY_FIELD("threads", threads_str);
+    TELEMETRY_FIELD("in_flight", inflight_str);
+    TELEMETRY_FIELD("jobs_ok", ok_str);
+    TELEMETRY_FIELD("jobs_failed", failed_str);
+    TELEMETRY_FIELD("pool_used", used_str);
+    TELEMETRY_FIELD("pool_capacity", cap_str);
+
+    return telemetry_xadd(client, argc, argv, argvlen);
+}
+
 int redis_update_job_status(redis_client_t *client, const char *job_id, const char *status) {
     if (!client || !client->context || !job_id || !status) return -1;
     
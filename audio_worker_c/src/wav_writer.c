@@ -1,28 +1,22 @@
 #include "wav_writer.h"
+#include "buffer_pool.h"
 #include <stdlib.h>
 #include <string.h>
 
-int create_wav_file(const int16_t *pcm_data, size_t sample_count, 
-                   uint32_t sample_rate, uint16_t num_channels,
-                   uint8_t **wav_data_out, size_t *wav_size_out) {
-    
-    if (!pcm_data || !wav_data_out || !wav_size_out || sample_count == 0) {
+size_t wav_header_size(void) {
+    return sizeof(wav_header_t) + sizeof(wav_fmt_chunk_t) + sizeof(wav_data_chunk_t);
+}
+
+int wav_write_header(uint8_t *dest, size_t sample_count,
+                     uint32_t sample_rate, uint16_t num_channels) {
+    if (!dest || sample_count == 0) {
         return -1;
     }
-    
-    // Calculate sizes
+
     size_t pcm_data_size = sample_count * num_channels * sizeof(int16_t);
-    size_t wav_file_size = sizeof(wav_header_t) + sizeof(wav_fmt_chunk_t) + 
-                          sizeof(wav_data_chunk_t) + pcm_data_size;
-    
-    // Allocate memory for WAV file
-    uint8_t *wav_data = malloc(wav_file_size);
-    if (!wav_data) {
-        return -1;
-    }
-    
-    uint8_t *ptr = wav_data;
-    
+    size_t wav_file_size = wav_header_size() + pcm_data_size;
+    uint8_t *ptr = dest;
+
     // WAV header
     wav_header_t header = {0};
     memcpy(header.chunk_id, "RIFF", 4);
@@ -30,7 +24,7 @@ int create_wav_file(const int16_t *pcm_data, size_t sample_count,
     memcpy(header.format, "WAVE", 4);
     memcpy(ptr, &header, sizeof(header));
     ptr += sizeof(header);
-    
+
     // Format chunk
     wav_fmt_chunk_t fmt_chunk = {0};
     memcpy(fmt_chunk.subchunk1_id, "fmt ", 4);
@@ -43,19 +37,65 @@ int create_wav_file(const int16_t *pcm_data, size_t sample_count,
     fmt_chunk.block_align = num_channels * (fmt_chunk.bits_per_sample / 8);
     memcpy(ptr, &fmt_chunk, sizeof(fmt_chunk));
     ptr += sizeof(fmt_chunk);
-    
+
     // Data chunk header
     wav_data_chunk_t data_chunk = {0};
     memcpy(data_chunk.subchunk2_id, "data", 4);
     data_chunk.subchunk2_size = (uint32_t)pcm_data_size;
     memcpy(ptr, &data_chunk, sizeof(data_chunk));
-    ptr += sizeof(data_chunk);
-    
+
+    return 0;
+}
+
+int wav_image_create(size_t sample_count, uint32_t sample_rate,
+                     uint16_t num_channels, uint8_t **wav_data_out,
+                     size_t *wav_size_out, int16_t **pcm_out) {
+    if (!wav_data_out || !wav_size_out || !pcm_out || sample_count == 0) {
+        return -1;
+    }
+
+    size_t pcm_data_size = sample_count * num_channels * sizeof(int16_t);
+    size_t wav_file_size = wav_header_size() + pcm_data_size;
+
+    uint8_t *wav_data = pool_malloc(wav_file_size);
+    if (!wav_data) {
+        return -1;
+    }
+
+    wav_write_header(wav_data, sample_count, sample_rate, num_channels);
+
+    *wav_data_out = wav_data;
+    *wav_size_out = wav_file_size;
+    *pcm_out = (int16_t*)(wav_data + wav_header_size());
+
+    return 0;
+}
+
+int create_wav_file(const int16_t *pcm_data, size_t sample_count,
+                   uint32_t sample_rate, uint16_t num_channels,
+                   uint8_t **wav_data_out, size_t *wav_size_out) {
+
+    if (!pcm_data || !wav_data_out || !wav_size_out || sample_count == 0) {
+        return -1;
+    }
+
+    // Calculate sizes
+    size_t pcm_data_size = sample_count * num_channels * sizeof(int16_t);
+    size_t wav_file_size = wav_header_size() + pcm_data_size;
+
+    // Allocate memory for WAV file (job-scoped, from the worker pool)
+    uint8_t *wav_data = pool_malloc(wav_file_size);
+    if (!wav_data) {
+        return -1;
+    }
+
+    wav_write_header(wav_data, sample_count, sample_rate, num_channels);
+
     // PCM data
-    memcpy(ptr, pcm_data, pcm_data_size);
-    
+    memcpy(wav_data + wav_header_size(), pcm_data, pcm_data_size);
+
     *wav_data_out = wav_data;
     *wav_size_out = wav_file_size;
-    
+
     return 0;
-}
\ No newline at end of file
+}